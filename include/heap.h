@@ -130,6 +130,20 @@ typedef struct st_hp_keydef		/* Key definition with open */
   uint (*get_key_length)(struct st_hp_keydef *keydef, const uchar *key);
 } HP_KEYDEF;
 
+/*
+  Location of a BLOB column in the record of an internal temporary table.
+  The record stores the length of the value in packlength bytes, followed
+  by a pointer to the value. The values of all BLOB columns of a row are
+  kept in a single separately allocated chunk, in the order of the
+  HP_BLOB_DESC array.
+*/
+
+typedef struct st_hp_blob_desc
+{
+  uint offset;				/* Offset of the column in record */
+  uint packlength;			/* Bytes used to store the length */
+} HP_BLOB_DESC;
+
 typedef struct st_heap_share
 {
   HP_BLOCK block;
@@ -158,6 +172,8 @@ typedef struct st_heap_share
   LIST open_list;
   uint auto_key;
   uint auto_key_type;			/* real type of the auto key segment */
+  HP_BLOB_DESC *blob_descs;		/* BLOB columns, for internal tables */
+  uint blobs;				/* Number of BLOB columns */
 } HP_SHARE;
 
 struct st_hp_hash_info;
@@ -188,6 +204,8 @@ typedef struct st_heap_info
 typedef struct st_heap_create_info
 {
   HP_KEYDEF *keydef;
+  HP_BLOB_DESC *blob_descs;             /* BLOB columns (internal tables) */
+  uint blobs;
   uint auto_key;                        /* keynr [1 - maxkey] for auto key */
   uint auto_key_type;
   uint keys;
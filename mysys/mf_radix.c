@@ -58,3 +58,130 @@ void radixsort_for_str_ptr(uchar **base, uint number_of_elements, size_t size_of
   next:;
   }
 }
+
+
+/*
+  MSD radix sort for pointers to fixed length strings of any length.
+
+  Sorts on the first byte that differs between the keys of a range and
+  continues within each bucket, so that long keys with short distinct
+  prefixes are sorted in a few passes. Small buckets are finished with
+  insertion sort. The sort is stable.
+
+  Needs an extra buffer of number_of_elements pointers.
+
+  RETURN
+    0  ok
+    1  out of memory, nothing was changed
+*/
+
+#define RADIX_MSD_INSERTION_SORT_LIMIT 32
+
+typedef struct st_radix_range
+{
+  uchar **base;
+  uint elements;
+  size_t offset;
+} RADIX_RANGE;
+
+
+static void insertion_sort_str_ptr(uchar **base, uint number_of_elements,
+                                   size_t offset, size_t length)
+{
+  uchar **ptr, **end= base + number_of_elements, **pos;
+  for (ptr= base + 1 ; ptr < end ; ptr++)
+  {
+    uchar *key= *ptr;
+    for (pos= ptr ;
+         pos > base && memcmp(pos[-1] + offset, key + offset, length) > 0 ;
+         pos--)
+      *pos= pos[-1];
+    *pos= key;
+  }
+}
+
+
+my_bool radixsort_msd_for_str_ptr(uchar **base, uint number_of_elements,
+                                  size_t size_of_element, uchar **buffer)
+{
+  RADIX_RANGE *stack, *top;
+  uint32 count[256];
+
+  /*
+    Only ranges larger than RADIX_MSD_INSERTION_SORT_LIMIT are pushed and
+    the pushed ranges never overlap, which bounds the size of the stack.
+  */
+  if (!(stack= (RADIX_RANGE*)
+        my_malloc(PSI_INSTRUMENT_ME,
+                  (number_of_elements / RADIX_MSD_INSERTION_SORT_LIMIT + 1) *
+                  sizeof(RADIX_RANGE), MYF(MY_THREAD_SPECIFIC))))
+    return 1;
+
+  top= stack;
+  top->base= base;
+  top->elements= number_of_elements;
+  top->offset= 0;
+  top++;
+
+  while (top != stack)
+  {
+    RADIX_RANGE range= *--top;
+    uchar **ptr, **end= range.base + range.elements;
+    uint32 pos, i;
+
+    if (range.elements <= RADIX_MSD_INSERTION_SORT_LIMIT)
+    {
+      insertion_sort_str_ptr(range.base, range.elements, range.offset,
+                             size_of_element - range.offset);
+      continue;
+    }
+
+    /* Skip bytes that are the same in all keys of the range */
+    for (;;)
+    {
+      if (range.offset == size_of_element)
+        goto next;                              /* All keys are equal */
+      bzero((uchar*) count, sizeof(count));
+      for (ptr= range.base ; ptr < end ; ptr++)
+        count[ptr[0][range.offset]]++;
+      if (count[range.base[0][range.offset]] != range.elements)
+        break;
+      range.offset++;
+    }
+
+    /* Turn the counts into start positions of the buckets */
+    for (i= 0, pos= 0 ; i < 256 ; i++)
+    {
+      uint32 elements= count[i];
+      count[i]= pos;
+      pos+= elements;
+    }
+    for (ptr= range.base ; ptr < end ; ptr++)
+      buffer[count[ptr[0][range.offset]]++]= *ptr;
+    memcpy(range.base, buffer, range.elements * sizeof(uchar*));
+
+    /* count[i] is now the end of bucket i */
+    range.offset++;
+    if (range.offset == size_of_element)
+      continue;
+    for (i= 0, pos= 0 ; i < 256 ; pos= count[i++])
+    {
+      uint32 elements= count[i] - pos;
+      if (elements <= 1)
+        continue;
+      if (elements <= RADIX_MSD_INSERTION_SORT_LIMIT)
+        insertion_sort_str_ptr(range.base + pos, elements, range.offset,
+                               size_of_element - range.offset);
+      else
+      {
+        top->base= range.base + pos;
+        top->elements= elements;
+        top->offset= range.offset;
+        top++;
+      }
+    }
+  next:;
+  }
+  my_free(stack);
+  return 0;
+}
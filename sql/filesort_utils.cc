@@ -159,6 +159,9 @@ void Filesort_buffer::free_sort_buffer()
 }
 
 
+/* Smaller buffers are sorted with my_qsort2() */
+#define MIN_RADIXSORT_RECORDS 1000
+
 void Filesort_buffer::sort_buffer(const Sort_param *param, uint count)
 {
   size_t size= param->sort_length;
@@ -173,13 +176,29 @@ void Filesort_buffer::sort_buffer(const Sort_param *param, uint count)
 
   uchar **buffer= NULL;
   if (!param->using_packed_sortkeys() &&
-      radixsort_is_appliccable(count, param->sort_length) &&
+      count >= MIN_RADIXSORT_RECORDS &&
       (buffer= (uchar**) my_malloc(PSI_INSTRUMENT_ME, count*sizeof(char*),
                                    MYF(MY_THREAD_SPECIFIC))))
   {
-    radixsort_for_str_ptr(m_sort_keys, count, param->sort_length, buffer);
+    /*
+      Fixed size sort keys are compared with memcmp(), so they can be
+      radix sorted. Short keys are sorted LSD first, longer ones and large
+      buffers MSD first, which only looks at the bytes up to the first
+      difference.
+    */
+    if (radixsort_is_appliccable(count, param->sort_length))
+    {
+      radixsort_for_str_ptr(m_sort_keys, count, param->sort_length, buffer);
+      my_free(buffer);
+      return;
+    }
+    if (!radixsort_msd_for_str_ptr(m_sort_keys, count, param->sort_length,
+                                   buffer))
+    {
+      my_free(buffer);
+      return;
+    }
     my_free(buffer);
-    return;
   }
 
   my_qsort2(m_sort_keys, count, sizeof(uchar*),
@@ -3087,6 +3087,29 @@ int handler::ha_rnd_next(uchar *buf)
   DBUG_RETURN(result);
 }
 
+/*
+  Return the next row of a sampled table scan
+
+  NOTE
+    Every row of the table is read, and each is kept with probability
+    sample_fraction.
+*/
+
+int handler::sample_next(uchar *buf)
+{
+  int result;
+  THD *thd= table->in_use;
+
+  while (!(result= ha_rnd_next(buf)))
+  {
+    if (sample_fraction >= 1.0 || thd_rnd(thd) <= sample_fraction)
+      break;
+    if (thd->check_killed(1))
+      return HA_ERR_ABORTED_BY_USER;
+  }
+  return result;
+}
+
 int handler::ha_rnd_pos(uchar *buf, uchar *pos)
 {
   int result;
@@ -3085,6 +3085,7 @@ class handler :public Sql_alloc
   Table_flags cached_table_flags;       /* Set on init() and open() */
 
   ha_rows estimation_rows_to_insert;
+  double sample_fraction;     /* Rows kept by the default sample_next() */
   handler *lookup_handler;
 public:
   handlerton *ht;                 /* storage engine of this handler */
@@ -3281,7 +3282,7 @@ class handler :public Sql_alloc
 public:
   handler(handlerton *ht_arg, TABLE_SHARE *share_arg)
     :table_share(share_arg), table(0),
-    estimation_rows_to_insert(0),
+    estimation_rows_to_insert(0), sample_fraction(1.0),
     lookup_handler(this),
     ht(ht_arg), ref(0), lookup_buffer(NULL), end_range(NULL),
     implicit_emptied(0),
@@ -3386,6 +3387,28 @@ class handler :public Sql_alloc
     DBUG_RETURN(rnd_end());
   }
   int ha_rnd_init_with_error(bool scan) __attribute__ ((warn_unused_result));
+  /**
+    Sampled table scan, used to collect engine-independent statistics.
+    ha_sample_next() returns a random subset of about 'fraction' of the
+    rows of the table.
+  */
+  int ha_sample_init(double fraction) __attribute__ ((warn_unused_result))
+  {
+    DBUG_ENTER("ha_sample_init");
+    DBUG_ASSERT(inited==NONE);
+    DBUG_ASSERT(fraction > 0 && fraction <= 1);
+    DBUG_RETURN(sample_init(fraction));
+  }
+  int ha_sample_next(uchar *buf)
+  {
+    DBUG_ASSERT(inited==RND);
+    return sample_next(buf);
+  }
+  int ha_sample_end()
+  {
+    DBUG_ENTER("ha_sample_end");
+    DBUG_RETURN(sample_end());
+  }
   int ha_reset();
   /* this is necessary in many places, e.g. in HANDLER command */
   int ha_index_or_rnd_end()
@@ -3931,6 +3954,20 @@ class handler :public Sql_alloc
     return error;
   }
   virtual int read_first_row(uchar *buf, uint primary_key);
+protected:
+  /*
+    The default implementation reads every row and keeps each one with
+    probability sample_fraction. Engines that can skip whole pages of
+    the table override sample_init() to do the sampling themselves and
+    set sample_fraction to 1 so that every row they return is kept.
+  */
+  virtual int sample_init(double fraction)
+  {
+    sample_fraction= fraction;
+    return ha_rnd_init(TRUE);
+  }
+  virtual int sample_next(uchar *buf);
+  virtual int sample_end() { return ha_rnd_end(); }
 public:
 
   /* Same as above, but with statistics */
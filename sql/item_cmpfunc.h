@@ -2441,6 +2441,8 @@ class Item_func_in :public Item_func_opt_neg,
                       table_map usable_tables, SARGABLE_PARAM **sargables);
   SEL_TREE *get_mm_tree(RANGE_OPT_PARAM *param, Item **cond_ptr);
   SEL_TREE *get_func_row_mm_tree(RANGE_OPT_PARAM *param, Item_row *key_row); 
+  bool get_func_sorted_mm_tree(RANGE_OPT_PARAM *param, Field *field,
+                               SEL_TREE **tree);
   Item* propagate_equal_fields(THD *thd, const Context &ctx, COND_EQUAL *cond)
   {
     /*
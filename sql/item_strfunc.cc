@@ -494,12 +494,12 @@ String *Item_func_from_base64::val_str(String *str)
 
 
 const char *histogram_types[] =
-           {"SINGLE_PREC_HB", "DOUBLE_PREC_HB", 0};
+           {"SINGLE_PREC_HB", "DOUBLE_PREC_HB", "DOUBLE_PREC_MCV_HB", 0};
 static TYPELIB hystorgam_types_typelib=
   { array_elements(histogram_types),
     "histogram_types",
     histogram_types, NULL};
-const char *representation_by_type[]= {"%.3f", "%.5f"};
+const char *representation_by_type[]= {"%.3f", "%.5f", "%.5f"};
 
 String *Item_func_decode_histogram::val_str(String *str)
 {
@@ -524,7 +524,18 @@ String *Item_func_decode_histogram::val_str(String *str)
     null_value= 1;
     return 0;
   }
-  if (type == DOUBLE_PREC_HB && res->length() % 2 != 0)
+  uint start= 0;
+  if (type == DOUBLE_PREC_MCV_HB && res->length())
+  {
+    /* Skip the list of the most common values, decode the buckets only */
+    start= 1 + (uint) (uchar) (*res)[0] * HIST_MCV_SLOT_SIZE;
+    if (start > res->length())
+    {
+      null_value= 1;
+      return 0;
+    }
+  }
+  if (type != SINGLE_PREC_HB && (res->length() - start) % 2 != 0)
     res->length(res->length() - 1); // one byte is unused
 
   double prev= 0.0;
@@ -532,7 +543,7 @@ String *Item_func_decode_histogram::val_str(String *str)
   str->length(0);
   char numbuf[32];
   const uchar *p= (uchar*)res->c_ptr_safe();
-  for (i= 0; i < res->length(); i++)
+  for (i= start; i < res->length(); i++)
   {
     double val;
     switch (type)
@@ -541,6 +552,7 @@ String *Item_func_decode_histogram::val_str(String *str)
       val= p[i] / ((double)((1 << 8) - 1));
       break;
     case DOUBLE_PREC_HB:
+    case DOUBLE_PREC_MCV_HB:
       val= uint2korr(p + i) / ((double)((1 << 16) - 1));
       i++;
       break;
@@ -1944,6 +1944,181 @@ void Item_sum_count::cleanup()
 }
 
 
+/*
+  Approximate count of distinct values (HyperLogLog)
+*/
+
+/* Finalization step of MurmurHash3, spreads all input bits over the result */
+
+static inline ulonglong hll_mix(ulonglong h)
+{
+  h^= h >> 33;
+  h*= 0xff51afd7ed558ccdULL;
+  h^= h >> 33;
+  h*= 0xc4ceb9fe1a85ec53ULL;
+  h^= h >> 33;
+  return h;
+}
+
+
+/* FNV-1a over a byte string, for values without a cheaper native hash */
+
+static inline ulonglong hll_hash_bytes(const uchar *pos, size_t length)
+{
+  ulonglong h= 0xcbf29ce484222325ULL;
+  for (const uchar *end= pos + length; pos < end; pos++)
+  {
+    h^= *pos;
+    h*= 0x100000001b3ULL;
+  }
+  return hll_mix(h);
+}
+
+
+Item *Item_sum_approx_count_distinct::copy_or_same(THD* thd)
+{
+  return new (thd->mem_root) Item_sum_approx_count_distinct(thd, this);
+}
+
+
+bool Item_sum_approx_count_distinct::setup(THD *thd)
+{
+  DBUG_ENTER("Item_sum_approx_count_distinct::setup");
+  if (!registers &&
+      !(registers= (uchar*) thd->calloc(HLL_REGISTERS)))
+    DBUG_RETURN(TRUE);
+  DBUG_RETURN(FALSE);
+}
+
+
+void Item_sum_approx_count_distinct::clear()
+{
+  if (registers)
+    bzero(registers, HLL_REGISTERS);
+}
+
+
+/**
+  Hash the current value of the argument.
+
+  Values that compare equal must hash equal, so numbers are hashed by
+  value, temporal values in their packed form and strings with the hash
+  function of their collation.
+
+  @return hash of the value, the caller checks args[0]->null_value
+*/
+
+ulonglong Item_sum_approx_count_distinct::hash_arg()
+{
+  Item *arg= args[0];
+  switch (arg->cmp_type()) {
+  case INT_RESULT:
+    return hll_mix((ulonglong) arg->val_int());
+  case REAL_RESULT:
+  {
+    double nr= arg->val_real();
+    ulonglong bits;
+    if (nr == 0.0)
+      nr= 0.0;                                  // -0.0 == 0.0
+    memcpy(&bits, &nr, sizeof(bits));
+    return hll_mix(bits);
+  }
+  case DECIMAL_RESULT:
+  {
+    my_decimal value, *dec= arg->val_decimal(&value);
+    uchar buff[DECIMAL_MAX_FIELD_SIZE];
+    uint precision= arg->decimal_precision();
+    uint scale= MY_MIN(arg->decimals, DECIMAL_MAX_SCALE);
+    if (arg->null_value)
+      return 0;
+    dec->to_binary(buff, precision, scale);
+    return hll_hash_bytes(buff, my_decimal_get_binary_size(precision, scale));
+  }
+  case TIME_RESULT:
+  {
+    THD *thd= current_thd;
+    longlong packed= arg->field_type() == MYSQL_TYPE_TIME ?
+                     arg->val_time_packed(thd) :
+                     arg->val_datetime_packed(thd);
+    return hll_mix((ulonglong) packed);
+  }
+  case STRING_RESULT:
+  {
+    StringBuffer<STRING_BUFFER_USUAL_SIZE> tmp;
+    String *res= arg->val_str(&tmp);
+    ulong nr1= 1, nr2= 4;
+    if (arg->null_value)
+      return 0;
+    res->charset()->hash_sort((const uchar *) res->ptr(), res->length(),
+                              &nr1, &nr2);
+    return hll_mix((ulonglong) nr1 ^ ((ulonglong) nr2 << 32));
+  }
+  case ROW_RESULT:
+    break;
+  }
+  DBUG_ASSERT(0);
+  return 0;
+}
+
+
+bool Item_sum_approx_count_distinct::add()
+{
+  ulonglong hash= hash_arg();
+  if (args[0]->null_value)
+    return 0;
+  /*
+    The top HLL_PRECISION bits choose the register, the register keeps
+    the highest position of the first 1 bit seen in the remaining bits.
+    The guard bit bounds the rank for an all zero remainder.
+  */
+  uint index= (uint) (hash >> (64 - HLL_PRECISION));
+  ulonglong rest= (hash << HLL_PRECISION) |
+                  (1ULL << (HLL_PRECISION - 1));
+  uchar rank= 1;
+  while (!(rest & (1ULL << 63)))
+  {
+    rank++;
+    rest<<= 1;
+  }
+  if (registers[index] < rank)
+    registers[index]= rank;
+  return 0;
+}
+
+
+longlong Item_sum_approx_count_distinct::val_int()
+{
+  DBUG_ENTER("Item_sum_approx_count_distinct::val_int");
+  DBUG_ASSERT(fixed == 1);
+  if (!registers)
+    DBUG_RETURN(0);
+
+  const double m= (double) HLL_REGISTERS;
+  double sum= 0.0;
+  uint zeros= 0;
+  for (uint i= 0; i < HLL_REGISTERS; i++)
+  {
+    sum+= ldexp(1.0, -(int) registers[i]);
+    if (!registers[i])
+      zeros++;
+  }
+  double estimate= 0.7213 / (1.0 + 1.079 / m) * m * m / sum;
+  /* The raw estimate is biased for small cardinalities, use linear counting */
+  if (estimate <= 2.5 * m && zeros)
+    estimate= m * log(m / zeros);
+  DBUG_RETURN((longlong) (estimate + 0.5));
+}
+
+
+void Item_sum_approx_count_distinct::cleanup()
+{
+  DBUG_ENTER("Item_sum_approx_count_distinct::cleanup");
+  registers= NULL;
+  Item_sum_int::cleanup();
+  DBUG_VOID_RETURN;
+}
+
+
 /*
   Average
 */
@@ -2361,6 +2536,8 @@ void Item_sum_min_max::clear()
   DBUG_ENTER("Item_sum_min_max::clear");
   value->clear();
   null_value= 1;
+  window_first= window_count= 0;
+  window_rows_added= window_rows_removed= 0;
   DBUG_VOID_RETURN;
 }
 
@@ -2456,6 +2633,11 @@ void Item_sum_min_max::cleanup()
   if (cmp)
     delete cmp;
   cmp= 0;
+  if (window_cmp)
+    delete window_cmp;
+  window_cmp= 0;
+  window_values= 0;
+  window_removal= false;
   /*
     by default it is TRUE to avoid TRUE reporting by
     Item_func_not_all/Item_func_nop_all if this item was never called.
@@ -2490,6 +2672,153 @@ void Item_sum_min_max::restore_to_before_no_rows_in_result()
 }
 
 
+/*
+  Prepare MIN/MAX to be computed over a window frame
+
+  DESCRIPTION
+    MIN/MAX can not take a value out of the aggregate, so by default the
+    window function code rescans the whole frame for every row (see
+    Frame_scan_cursor), which is quadratic in the frame size.
+
+    If the top of the frame is UNBOUNDED PRECEDING, rows never leave the
+    frame, and the regular add() computes a running MIN/MAX.
+
+    If the frame slides and its bottom is not UNBOUNDED FOLLOWING, keep
+    the values of the frame that can still become the result: a value is
+    dropped as soon as a later row brings a better one. What remains is
+    ordered both by row and by value, the first value is the result, and
+    every row is added and removed once. Among equal values the earliest
+    row is kept first, so the result is the same as of a rescan.
+    Otherwise the frame is rescanned as before, since the kept values
+    could grow to the size of the partition.
+*/
+
+void Item_sum_min_max::setup_window_func(THD *thd, Window_spec *window_spec)
+{
+  Window_frame *frame= window_spec->window_frame;
+  DBUG_ENTER("Item_sum_min_max::setup_window_func");
+
+  /* is_unbounded() is also true for CURRENT ROW, check the direction */
+  if (!frame ||
+      (frame->top_bound->precedence_type == Window_frame_bound::PRECEDING &&
+       frame->top_bound->is_unbounded()))
+  {
+    window_removal= true;
+    DBUG_VOID_RETURN;
+  }
+  if ((frame->bottom_bound->precedence_type == Window_frame_bound::FOLLOWING &&
+       frame->bottom_bound->is_unbounded()) ||
+      args[0]->const_item() || !arg_cache)
+    DBUG_VOID_RETURN;
+
+  window_values_size= 16;
+  if (!(window_values= (Window_value*)
+        thd->calloc(window_values_size * sizeof(Window_value))) ||
+      !(window_values[0].cache= new_window_cache(thd)) ||
+      !(window_cmp= new Arg_comparator()))
+    DBUG_VOID_RETURN;
+  window_item= window_values[0].cache;
+  window_cmp->set_cmp_func(this, (Item**) &arg_cache, &window_item, FALSE);
+  window_first= window_count= 0;
+  window_rows_added= window_rows_removed= 0;
+  window_removal= true;
+  DBUG_VOID_RETURN;
+}
+
+
+Item_cache *Item_sum_min_max::new_window_cache(THD *thd)
+{
+  Item_cache *cache;
+  if (!(cache= args[0]->get_cache(thd)))
+    return NULL;
+  cache->setup(thd, args[0]);
+  /* See setup_hybrid() */
+  cache->set_used_tables(RAND_TABLE_BIT);
+  return cache;
+}
+
+
+/* Make the first kept value of the frame the result */
+
+void Item_sum_min_max::set_window_result()
+{
+  value->store(window_values[window_first].cache);
+  value->cache_value();
+  null_value= 0;
+}
+
+
+/* Add the current row to a sliding frame, see setup_window_func() */
+
+bool Item_sum_min_max::add_window_value()
+{
+  ulonglong row= window_rows_added++;
+  Window_value *last;
+
+  arg_cache->cache_value();
+  /*
+    NULLs are ignored. The top of the frame can be ahead of its bottom,
+    then the row has been removed from the frame before it was added.
+  */
+  if (arg_cache->null_value || row < window_rows_removed)
+    return 0;
+
+  /* Earlier values that are worse than the new one can't be the result */
+  while (window_count)
+  {
+    window_item= window_values[window_slot(window_count - 1)].cache;
+    if (window_cmp->compare() * cmp_sign >= 0)
+      break;
+    window_count--;
+  }
+
+  if (window_count == window_values_size)
+  {
+    Window_value *new_values;
+    if (!(new_values= (Window_value*)
+          current_thd->calloc(2 * window_values_size * sizeof(Window_value))))
+      return 1;
+    for (uint i= 0; i < window_values_size; i++)
+      new_values[i]= window_values[window_slot(i)];
+    window_values= new_values;
+    window_values_size*= 2;
+    window_first= 0;
+  }
+
+  last= &window_values[window_slot(window_count)];
+  if (!last->cache && !(last->cache= new_window_cache(current_thd)))
+    return 1;
+  last->cache->store(arg_cache);
+  last->cache->cache_value();
+  last->row= row;
+  if (!window_count++)
+    set_window_result();
+  return 0;
+}
+
+
+/*
+  Remove the first row of the frame
+
+  Rows are removed in the same order as they were added, so the row is
+  either the first kept value or it was dropped by add_window_value().
+*/
+
+void Item_sum_min_max::remove()
+{
+  ulonglong row= window_rows_removed++;
+  DBUG_ASSERT(window_cmp);
+
+  if (!window_count || window_values[window_first].row != row)
+    return;
+  window_first= window_slot(1);
+  if (--window_count)
+    set_window_result();
+  else
+    null_value= 1;
+}
+
+
 Item *Item_sum_min::copy_or_same(THD* thd)
 {
   DBUG_ENTER("Item_sum_min::copy_or_same");
@@ -2505,6 +2834,9 @@ bool Item_sum_min::add()
   DBUG_ENTER("Item_sum_min::add");
   DBUG_PRINT("enter", ("this: %p", this));
 
+  if (window_cmp)
+    DBUG_RETURN(add_window_value());
+
   if (unlikely(direct_added))
   {
     /* Change to use direct_item */
@@ -2545,6 +2877,9 @@ bool Item_sum_max::add()
   DBUG_ENTER("Item_sum_max::add");
   DBUG_PRINT("enter", ("this: %p", this));
 
+  if (window_cmp)
+    DBUG_RETURN(add_window_value());
+
   if (unlikely(direct_added))
   {
     /* Change to use direct_item */
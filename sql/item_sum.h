@@ -356,7 +356,7 @@ class Item_sum :public Item_func_or_sum
     CUME_DIST_FUNC, NTILE_FUNC, FIRST_VALUE_FUNC, LAST_VALUE_FUNC,
     NTH_VALUE_FUNC, LEAD_FUNC, LAG_FUNC, PERCENTILE_CONT_FUNC,
     PERCENTILE_DISC_FUNC, SP_AGGREGATE_FUNC, JSON_ARRAYAGG_FUNC,
-    JSON_OBJECTAGG_FUNC
+    JSON_OBJECTAGG_FUNC, APPROX_COUNT_DISTINCT_FUNC
   };
 
   Item **ref_by; /* pointer to a ref to the object used to register it */
@@ -430,6 +430,7 @@ class Item_sum :public Item_func_or_sum
     case UDF_SUM_FUNC:
     case GROUP_CONCAT_FUNC:
     case JSON_ARRAYAGG_FUNC:
+    case APPROX_COUNT_DISTINCT_FUNC:
       return true;
     default:
       return false;
@@ -919,6 +920,55 @@ class Item_sum_count :public Item_sum_int
 };
 
 
+/**
+  APPROX_COUNT_DISTINCT(expr)
+
+  Estimates the number of distinct non-NULL values of expr with a
+  HyperLogLog sketch of HLL_REGISTERS one-byte registers. Unlike
+  COUNT(DISTINCT) it needs neither a Unique tree nor a temporary table,
+  so memory use is fixed no matter how many distinct values there are.
+  The standard error of the estimate is about 1.04/sqrt(HLL_REGISTERS);
+  small cardinalities are counted (almost) exactly by linear counting.
+*/
+
+class Item_sum_approx_count_distinct :public Item_sum_int
+{
+  static const uint HLL_PRECISION= 14;
+  static const uint HLL_REGISTERS= 1U << HLL_PRECISION;
+
+  uchar *registers;
+
+  ulonglong hash_arg();
+  void clear();
+  bool add();
+  void cleanup();
+
+public:
+  Item_sum_approx_count_distinct(THD *thd, Item *item_par):
+    Item_sum_int(thd, item_par), registers(NULL)
+  {
+    quick_group= 0;
+  }
+  Item_sum_approx_count_distinct(THD *thd,
+                                 Item_sum_approx_count_distinct *item):
+    Item_sum_int(thd, item), registers(NULL)
+  {
+    quick_group= 0;
+  }
+  enum Sumfunctype sum_func () const { return APPROX_COUNT_DISTINCT_FUNC; }
+  bool setup(THD *thd);
+  void no_rows_in_result() { clear(); }
+  const Type_handler *type_handler() const { return &type_handler_slonglong; }
+  longlong val_int();
+  void reset_field() { DBUG_ASSERT(0); }        // not used
+  void update_field() { DBUG_ASSERT(0); }       // not used
+  const char *func_name() const { return "approx_count_distinct("; }
+  Item *copy_or_same(THD* thd);
+  Item *get_copy(THD *thd)
+  { return get_item_copy<Item_sum_approx_count_distinct>(thd, this); }
+};
+
+
 class Item_sum_avg :public Item_sum_sum
 {
 public:
@@ -1114,16 +1164,41 @@ class Item_sum_min_max :public Item_sum_hybrid
   bool was_values;  // Set if we have found at least one row (for max/min only)
   bool was_null_value;
 
+  /*
+    Window function support, see setup_window_func(). When the frame
+    slides, window_values holds the values of the frame that can still
+    become the result, ordered by row and from the best value on.
+  */
+  struct Window_value
+  {
+    Item_cache *cache;
+    ulonglong row;                      // Number of the row in the frame
+  };
+  bool window_removal;                  // supports_removal()
+  Arg_comparator *window_cmp;           // Compares arg_cache to window_item
+  Item *window_item;
+  Window_value *window_values;          // Ring buffer
+  uint window_values_size, window_first, window_count;
+  ulonglong window_rows_added, window_rows_removed;
+
+  uint window_slot(uint idx) const
+  { return (window_first + idx) % window_values_size; }
+  Item_cache *new_window_cache(THD *thd);
+  bool add_window_value();
+  void set_window_result();
+
 public:
   Item_sum_min_max(THD *thd, Item *item_par,int sign):
     Item_sum_hybrid(thd, item_par),
     direct_added(FALSE), value(0), arg_cache(0), cmp(0),
-    cmp_sign(sign), was_values(TRUE)
+    cmp_sign(sign), was_values(TRUE),
+    window_removal(false), window_cmp(0), window_values(0)
   { collation.set(&my_charset_bin); }
   Item_sum_min_max(THD *thd, Item_sum_min_max *item)
     :Item_sum_hybrid(thd, item),
     direct_added(FALSE), value(item->value), arg_cache(0),
-    cmp_sign(item->cmp_sign), was_values(item->was_values)
+    cmp_sign(item->cmp_sign), was_values(item->was_values),
+    window_removal(false), window_cmp(0), window_values(0)
   { }
   bool fix_fields(THD *, Item **);
   bool fix_length_and_dec();
@@ -1154,6 +1229,9 @@ class Item_sum_min_max :public Item_sum_hybrid
   void restore_to_before_no_rows_in_result();
   Field *create_tmp_field(MEM_ROOT *root, bool group, TABLE *table);
   void setup_caches(THD *thd) { setup_hybrid(thd, arguments()[0], NULL); }
+  void setup_window_func(THD *thd, Window_spec *window_spec);
+  bool supports_removal() const { return window_removal; }
+  void remove();
 };
 
 
@@ -1792,6 +1792,15 @@ void MDL_lock::remove_ticket(LF_PINS *pins, Ticket_list MDL_lock::*list,
   (this->*list).remove_ticket(ticket);
   if (is_empty())
     mdl_locks.remove(pins, this);
+  else if (m_waiting.is_empty())
+  {
+    /*
+      Nobody to wake up. This is the common case of releasing one of
+      many shared locks on a hot object, so avoid reschedule_waiters().
+    */
+    m_hog_lock_count= 0;
+    mysql_prlock_unlock(&m_rwlock);
+  }
   else
   {
     /*
@@ -2069,13 +2078,11 @@ MDL_context::try_acquire_lock_impl(MDL_request *mdl_request,
                                    )))
     return TRUE;
 
-  /* The below call implicitly locks MDL_lock::m_rwlock on success. */
-  if (!(lock= mdl_locks.find_or_insert(m_pins, key)))
-  {
-    MDL_ticket::destroy(ticket);
-    return TRUE;
-  }
-
+  /*
+    Everything that does not depend on the state of MDL_lock is done
+    before MDL_lock::m_rwlock is taken, as all requests for a hot object
+    serialize on it.
+  */
   DBUG_ASSERT(ticket->m_psi == NULL);
   ticket->m_psi= mysql_mdl_create(ticket,
                                   &mdl_request->key,
@@ -2085,6 +2092,13 @@ MDL_context::try_acquire_lock_impl(MDL_request *mdl_request,
                                   mdl_request->m_src_file,
                                   mdl_request->m_src_line);
 
+  /* The below call implicitly locks MDL_lock::m_rwlock on success. */
+  if (!(lock= mdl_locks.find_or_insert(m_pins, key)))
+  {
+    MDL_ticket::destroy(ticket);
+    return TRUE;
+  }
+
   ticket->m_lock= lock;
 
   if (lock->can_grant_lock(mdl_request->type, this, false))
@@ -7740,6 +7740,208 @@ SEL_TREE *Item_func_between::get_func_mm_tree(RANGE_OPT_PARAM *param,
 }
 
 
+/*
+  Link a list of SEL_ARG elements into a balanced red-black tree
+
+  SYNOPSIS
+    link_sorted_sel_args()
+    list       IN/OUT The first element of the list that is not linked yet
+    count      Number of elements to link
+    depth      Depth of the subtree root in the whole tree
+    red_depth  Depth of the elements that are coloured red
+
+  NOTE
+    The sizes of the two subtrees of every element differ by at most one,
+    so all leaves are on the two deepest levels. Colouring the deepest
+    level red when it is not full gives every path the same number of
+    black elements.
+
+  RETURN
+    Root of the subtree
+*/
+
+static SEL_ARG *link_sorted_sel_args(SEL_ARG **list, uint count, uint depth,
+                                     uint red_depth)
+{
+  SEL_ARG *root, *left;
+  uint left_count;
+
+  if (!count)
+    return &null_element;
+  left_count= (count - 1) / 2;
+  left= link_sorted_sel_args(list, left_count, depth + 1, red_depth);
+  root= *list;
+  *list= root->next;
+  root->left= left;
+  root->right= link_sorted_sel_args(list, count - 1 - left_count, depth + 1,
+                                    red_depth);
+  if (root->left != &null_element)
+    root->left->parent= root;
+  if (root->right != &null_element)
+    root->right->parent= root;
+  root->color= depth == red_depth ? SEL_ARG::RED : SEL_ARG::BLACK;
+  return root;
+}
+
+
+/*
+  Build the SEL_TREE for "field IN (c1, ..., cN)" with constant c{i}
+
+  SYNOPSIS
+    get_func_sorted_mm_tree()
+    param   PARAM from SQL_SELECT::test_quick_select
+    field   The field the predicate is on
+    tree    OUT The built SEL_TREE
+
+  DESCRIPTION
+    The values in 'array' are sorted, so normally they produce the point
+    intervals of every index in ascending order. Instead of building a
+    SEL_TREE for each value and ORing it into the result with key_or(),
+    the intervals are appended to one list per index, equal intervals
+    are skipped, and each list is linked into a balanced red-black tree
+    at the end. This needs no SEL_TREE and no tree search per value,
+    which matters for IN lists with thousands of values.
+
+  RETURN
+    FALSE  Ok, *tree is set (it is NULL if no tree can be built)
+    TRUE   The intervals are not in ascending order or not simple point
+           intervals; the caller has to build the tree with tree_or()
+*/
+
+bool Item_func_in::get_func_sorted_mm_tree(RANGE_OPT_PARAM *param,
+                                           Field *field, SEL_TREE **tree)
+{
+  KEY_PART *key_part, *end= param->key_parts_end;
+  uint key_parts= (uint) (end - param->key_parts);
+  uint count= 0;
+  SEL_TREE *res;
+  SEL_ARG **last, **leaves;
+  key_map used_keys;
+  MEM_ROOT *tmp_root= param->mem_root;
+  DBUG_ENTER("Item_func_in::get_func_sorted_mm_tree");
+
+  *tree= NULL;
+  if (field->table != param->table)
+    DBUG_RETURN(FALSE);
+
+  /* See the comment about value_item for NOT IN in get_func_mm_tree() */
+  param->thd->mem_root= param->old_root;
+  Item *value_item= array->create_item(param->thd);
+  param->thd->mem_root= tmp_root;
+
+  if (!value_item ||
+      !(res= new (param->mem_root) SEL_TREE(param->mem_root, param->keys)) ||
+      !(last= (SEL_ARG**) alloc_root(param->mem_root,
+                                     sizeof(SEL_ARG*) * param->keys)) ||
+      !(leaves= (SEL_ARG**) alloc_root(param->mem_root,
+                                       sizeof(SEL_ARG*) * key_parts)))
+    DBUG_RETURN(FALSE);                         // OOM
+  bzero(last, sizeof(SEL_ARG*) * param->keys);
+  used_keys.clear_all();
+
+  for (uint i= 0; i < array->used_count; i++)
+  {
+    key_map value_keys;
+    bool impossible= false;
+    uint seen= 0, after= 0;
+
+    array->value_to_item(i, value_item);
+    value_keys.clear_all();
+    for (key_part= param->key_parts; key_part != end; key_part++)
+    {
+      SEL_ARG *sel_arg;
+      leaves[key_part - param->key_parts]= NULL;
+      if (!field->eq(key_part->field))
+        continue;
+      /* The value is evaluated here, see get_mm_parts() */
+      param->thd->mem_root= param->old_root;
+      sel_arg= get_mm_leaf(param, key_part->field, key_part,
+                           Item_func::EQ_FUNC, value_item);
+      param->thd->mem_root= tmp_root;
+      if (!sel_arg)
+        continue;
+      if (sel_arg->type == SEL_ARG::IMPOSSIBLE)
+      {
+        impossible= true;
+        break;
+      }
+      if (sel_arg->type != SEL_ARG::KEY_RANGE || sel_arg->next_key_part ||
+          sel_arg->elements != 1 ||
+          ((sel_arg->min_flag | sel_arg->max_flag) & GEOM_FLAG) ||
+          value_keys.is_set(key_part->key))
+        DBUG_RETURN(TRUE);
+      sel_arg->part= (uchar) key_part->part;
+      sel_arg->max_part_no= sel_arg->part + 1;
+      value_keys.set_bit(key_part->key);
+      leaves[key_part - param->key_parts]= sel_arg;
+
+      SEL_ARG *prev= last[key_part->key];
+      if (prev)
+      {
+        seen++;
+        if (prev->cmp_max_to_min(sel_arg) == -1)
+          after++;
+        else if (prev->cmp_min_to_min(sel_arg) || prev->cmp_max_to_max(sel_arg))
+          DBUG_RETURN(TRUE);                    // Out of order or overlapping
+      }
+    }
+    if (impossible)
+      continue;                                 // The value adds no ranges
+    if (value_keys.is_clear_all() || (count && !(value_keys == used_keys)))
+      DBUG_RETURN(TRUE);
+    if (after != seen)
+    {
+      if (after)
+        DBUG_RETURN(TRUE);
+      continue;                                 // Same value as the last one
+    }
+
+    for (key_part= param->key_parts; key_part != end; key_part++)
+    {
+      SEL_ARG *sel_arg= leaves[key_part - param->key_parts];
+      if (!sel_arg)
+        continue;
+      if (last[key_part->key])
+      {
+        last[key_part->key]->next= sel_arg;
+        sel_arg->prev= last[key_part->key];
+      }
+      else
+        res->keys[key_part->key]= sel_arg;
+      last[key_part->key]= sel_arg;
+    }
+    used_keys= value_keys;
+    count++;
+  }
+
+  if (!count)
+    DBUG_RETURN(TRUE);                          // All values are impossible
+
+  uint red_depth= 0;
+  while ((2U << red_depth) <= count)
+    red_depth++;
+  if (count == (2U << red_depth) - 1)
+    red_depth= UINT_MAX;                        // The tree is full
+
+  key_map::Iterator it(used_keys);
+  int key_no;
+  while ((key_no= it++) != key_map::Iterator::BITMAP_END)
+  {
+    SEL_ARG *list= res->keys[key_no], *root, *elem;
+    root= link_sorted_sel_args(&list, count, 0, red_depth);
+    root->parent= 0;
+    root->use_count= 1;
+    root->elements= count;
+    for (elem= root->first(); elem; elem= elem->next)
+      root->maybe_flag|= elem->maybe_flag;
+    res->keys[key_no]= root;
+    res->keys_map.set_bit(key_no);
+  }
+  *tree= res;
+  DBUG_RETURN(FALSE);
+}
+
+
 SEL_TREE *Item_func_in::get_func_mm_tree(RANGE_OPT_PARAM *param,
                                          Field *field, Item *value)
 {
@@ -7905,6 +8107,10 @@ SEL_TREE *Item_func_in::get_func_mm_tree(RANGE_OPT_PARAM *param,
   }
   else
   {
+    if (array && array->type_handler()->result_type() != ROW_RESULT &&
+        !get_func_sorted_mm_tree(param, field, &tree))
+      DBUG_RETURN(tree);
+
     tree= get_mm_parts(param, field, Item_func::EQ_FUNC, args[1]);
     if (tree)
     {
@@ -30,6 +30,8 @@ double Range_rowid_filter_cost_info::lookup_cost(
   switch (cont_type) {
   case SORTED_ARRAY_CONTAINER:
     return log(est_elements)*0.01;
+  case BLOOM_FILTER_CONTAINER:
+    return BLOOM_LOOKUP_COST;
   default:
     DBUG_ASSERT(0);
     return 0;
@@ -46,7 +48,11 @@ inline
 double Range_rowid_filter_cost_info::avg_access_and_eval_gain_per_row(
                                      Rowid_filter_container_type cont_type)
 {
-  return (1+1.0/TIME_FOR_COMPARE) * (1 - selectivity) -
+  double pass_rate= selectivity;
+  /* Rows that falsely pass a bloom filter are accessed in vain */
+  if (cont_type == BLOOM_FILTER_CONTAINER)
+    pass_rate+= (1 - selectivity) * BLOOM_FILTER_FALSE_POSITIVE_RATE;
+  return (1+1.0/TIME_FOR_COMPARE) * (1 - pass_rate) -
          lookup_cost(cont_type);
 }
 
@@ -146,6 +152,9 @@ Range_rowid_filter_cost_info::build_cost(Rowid_filter_container_type cont_type)
     cost+= ARRAY_WRITE_COST * est_elements; /* cost filling the container */
     cost+= ARRAY_SORT_C * est_elements * log(est_elements); /* sorting cost */
     break;
+  case BLOOM_FILTER_CONTAINER:
+    cost+= BLOOM_WRITE_COST * est_elements; /* cost filling the container */
+    break;
   default:
     DBUG_ASSERT(0);
   }
@@ -165,6 +174,9 @@ Rowid_filter_container *Range_rowid_filter_cost_info::create_container()
     res= new (thd->mem_root) Rowid_filter_sorted_array((uint) est_elements,
                                                        elem_sz);
     break;
+  case BLOOM_FILTER_CONTAINER:
+    res= new (thd->mem_root) Rowid_filter_bloom((uint) est_elements, elem_sz);
+    break;
   default:
     DBUG_ASSERT(0);
   }
@@ -315,6 +327,8 @@ get_max_range_rowid_filter_elems_for_table(
   switch (cont_type) {
   case SORTED_ARRAY_CONTAINER :
     return thd->variables.max_rowid_filter_size/tab->file->ref_length;
+  case BLOOM_FILTER_CONTAINER :
+    return thd->variables.max_rowid_filter_size*8/BLOOM_FILTER_BITS_PER_ELEM;
   default :
     DBUG_ASSERT(0);
     return 0;
@@ -347,14 +361,24 @@ void TABLE::init_cost_info_for_usable_range_rowid_filters(THD *thd)
 {
   uint key_no;
   key_map usable_range_filter_keys;
+  key_map bloom_filter_keys;
   usable_range_filter_keys.clear_all();
+  bloom_filter_keys.clear_all();
   key_map::Iterator it(opt_range_keys);
+  ulonglong max_array_elems=
+    get_max_range_rowid_filter_elems_for_table(thd, this,
+                                               SORTED_ARRAY_CONTAINER);
+  ulonglong max_bloom_elems=
+    get_max_range_rowid_filter_elems_for_table(thd, this,
+                                               BLOOM_FILTER_CONTAINER);
 
   /*
     From all indexes that can be used for range accesses select only such that
     - range filter pushdown is supported by the engine for them     (1)
     - they are not clustered primary                                (2)
     - the range filter containers for them are not too large        (3)
+    A bloom filter is used for the filters with too many elements to be
+    put into a sorted array.
   */
   while ((key_no= it++) != key_map::Iterator::BITMAP_END)
   {
@@ -362,10 +386,12 @@ void TABLE::init_cost_info_for_usable_range_rowid_filters(THD *thd)
       continue;
     if (file->is_clustering_key(key_no))                              // !2
       continue;
-   if (opt_range[key_no].rows >
-       get_max_range_rowid_filter_elems_for_table(thd, this,
-                                                  SORTED_ARRAY_CONTAINER)) // !3
-      continue;
+    if (opt_range[key_no].rows > max_array_elems)
+    {
+      if (opt_range[key_no].rows > max_bloom_elems)                   // !3
+        continue;
+      bloom_filter_keys.set_bit(key_no);
+    }
     usable_range_filter_keys.set_bit(key_no);
   }
 
@@ -401,7 +427,10 @@ void TABLE::init_cost_info_for_usable_range_rowid_filters(THD *thd)
   while ((key_no= li++) != key_map::Iterator::BITMAP_END)
   {
     *curr_ptr= curr_filter_cost_info;
-    curr_filter_cost_info->init(SORTED_ARRAY_CONTAINER, this, key_no);
+    curr_filter_cost_info->init(bloom_filter_keys.is_set(key_no) ?
+                                BLOOM_FILTER_CONTAINER :
+                                SORTED_ARRAY_CONTAINER,
+                                this, key_no);
     curr_ptr++;
     curr_filter_cost_info++;
   }
@@ -597,7 +626,7 @@ bool Range_rowid_filter::fill()
   file->pushed_idx_cond= pushed_idx_cond_save;
   file->pushed_idx_cond_keyno= pushed_idx_cond_keyno_save;
   file->in_range_check_pushed_down= in_range_check_pushed_down_save;
-  tracker->report_container_buff_size(table->file->ref_length);
+  tracker->report_container_buff_size(container->get_buffer_size());
 
   if (rc != HA_ERR_END_OF_FILE)
     return 1;
@@ -649,6 +678,79 @@ bool Rowid_filter_sorted_array::check(void *ctxt, char *elem)
 }
 
 
+/* FNV-1a hash of a rowid / primary key with the final mix of MurmurHash3 */
+
+ulonglong Rowid_filter_bloom::hash(const char *elem) const
+{
+  ulonglong h= 0xcbf29ce484222325ULL;
+  const uchar *pos= (const uchar *) elem;
+  for (const uchar *end= pos + elem_size; pos < end; pos++)
+  {
+    h^= *pos;
+    h*= 0x100000001b3ULL;
+  }
+  h^= h >> 33;
+  h*= 0xff51afd7ed558ccdULL;
+  h^= h >> 33;
+  h*= 0xc4ceb9fe1a85ec53ULL;
+  h^= h >> 33;
+  return h;
+}
+
+
+/**
+  @brief
+    Put a rowid / primary key into the bloom filter
+
+  @details
+    The BLOOM_FILTER_HASHES bit positions of an element are derived from
+    one hash value h as (h1 + i*h2) mod n_bits, where h1 and h2 are taken
+    from the two halves of h.
+
+  @retval
+    false   always
+*/
+
+bool Rowid_filter_bloom::add(void *ctxt, char *elem)
+{
+  ulonglong h= hash(elem);
+  ulonglong pos= h % n_bits;
+  ulonglong step= ((h >> 32) | 1) % n_bits;
+  for (uint i= 0; i < BLOOM_FILTER_HASHES; i++)
+  {
+    bits[pos / 8]|= (uchar) (1 << (pos % 8));
+    if ((pos+= step) >= n_bits)
+      pos-= n_bits;
+  }
+  return false;
+}
+
+
+/**
+  @brief
+    Check whether a rowid / primary key may be in the bloom filter
+
+  @retval
+    true    elem may be in the container
+    false   elem is definitely not in the container
+*/
+
+bool Rowid_filter_bloom::check(void *ctxt, char *elem)
+{
+  ulonglong h= hash(elem);
+  ulonglong pos= h % n_bits;
+  ulonglong step= ((h >> 32) | 1) % n_bits;
+  for (uint i= 0; i < BLOOM_FILTER_HASHES; i++)
+  {
+    if (!(bits[pos / 8] & (1 << (pos % 8))))
+      return false;
+    if ((pos+= step) >= n_bits)
+      pos-= n_bits;
+  }
+  return true;
+}
+
+
 Range_rowid_filter::~Range_rowid_filter()
 {
   delete container;
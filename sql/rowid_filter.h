@@ -149,11 +149,21 @@ class Range_rowid_filter_cost_info;
 #define ARRAY_SORT_C          0.01
 /* Cost to evaluate condition */
 #define COST_COND_EVAL  0.2
+/* Number of bits of a bloom filter per element put into it */
+#define BLOOM_FILTER_BITS_PER_ELEM  10
+/* Number of bits set / checked in a bloom filter per element */
+#define BLOOM_FILTER_HASHES  7
+/* False positive rate of a bloom filter with the above parameters */
+#define BLOOM_FILTER_FALSE_POSITIVE_RATE  0.0082
+/* Cost to write rowid into bloom filter */
+#define BLOOM_WRITE_COST      0.005
+/* Cost to check rowid against bloom filter */
+#define BLOOM_LOOKUP_COST     0.05
 
 typedef enum
 {
   SORTED_ARRAY_CONTAINER,
-  BLOOM_FILTER_CONTAINER      // Not used yet
+  BLOOM_FILTER_CONTAINER
 } Rowid_filter_container_type;
 
 /**
@@ -162,7 +172,7 @@ typedef enum
   The interface for different types of containers to store info on the set
   of rowids / primary keys that defines a pk-filter.
 
-  There will be two implementations of this abstract class.
+  There are two implementations of this abstract class.
   - sorted array
   - bloom filter
 */
@@ -192,6 +202,9 @@ class Rowid_filter_container : public Sql_alloc
   */
   virtual bool check(void *ctxt, char *elem) = 0;
 
+  /* Get the size of the data of the container in bytes */
+  virtual size_t get_buffer_size() = 0;
+
   virtual ~Rowid_filter_container() {}
 };
 
@@ -333,6 +346,8 @@ class Refpos_container_sorted_array : public Sql_alloc
 
   uint elements() { return (uint) (array->elements() / elem_size); }
 
+  size_t buffer_size() { return array->elements(); }
+
   void sort (int (*cmp) (void *ctxt, const void *el1, const void *el2),
                          void *cmp_arg)
   {
@@ -368,8 +383,61 @@ class Rowid_filter_sorted_array: public Rowid_filter_container
   bool add(void *ctxt, char *elem) { return refpos_container.add(elem); }
 
   bool check(void *ctxt, char *elem);
+
+  size_t get_buffer_size() { return refpos_container.buffer_size(); }
 };
 
+
+/**
+  @class Rowid_filter_bloom
+
+  The implementation of the Rowid_filter_container interface as
+  a bloom filter over rowids / primary keys.
+
+  The filter takes BLOOM_FILTER_BITS_PER_ELEM bits per expected element
+  whatever the length of the rowids, so it is used for range filters that
+  have too many elements to be kept in a sorted array. check() may return
+  true for a rowid that was never added; this is fine as the condition
+  the filter is built for is still checked for every row.
+*/
+
+class Rowid_filter_bloom: public Rowid_filter_container
+{
+  /* Number of bytes in a rowid / primary key */
+  uint elem_size;
+  /* Number of bits in the filter */
+  ulonglong n_bits;
+  uchar *bits;
+
+  ulonglong hash(const char *elem) const;
+
+public:
+  Rowid_filter_bloom(uint elems, uint elem_sz)
+    : elem_size(elem_sz), bits(0)
+  {
+    n_bits= MY_MAX((ulonglong) elems * BLOOM_FILTER_BITS_PER_ELEM, 64);
+  }
+
+  ~Rowid_filter_bloom() { my_free(bits); }
+
+  Rowid_filter_container_type get_type()
+  { return BLOOM_FILTER_CONTAINER; }
+
+  bool alloc()
+  {
+    bits= (uchar *) my_malloc(PSI_INSTRUMENT_ME, (size_t) (n_bits + 7) / 8,
+                              MYF(MY_ZEROFILL | MY_THREAD_SPECIFIC));
+    return bits == NULL;
+  }
+
+  bool add(void *ctxt, char *elem);
+
+  bool check(void *ctxt, char *elem);
+
+  size_t get_buffer_size() { return (size_t) (n_bits + 7) / 8; }
+};
+
+
 /**
   @class Range_rowid_filter_cost_info
 
@@ -390,9 +390,9 @@ class Rowid_filter_tracker : public Sql_alloc
   }
 
   /* Save container buffer size in bytes */
-  inline void report_container_buff_size(uint elem_size)
+  inline void report_container_buff_size(size_t size)
   {
-   container_buff_size= container_elements * elem_size / 8;
+    container_buff_size= size;
   }
 
   Time_and_counter_tracker *get_time_tracker()
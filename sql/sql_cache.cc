@@ -1365,6 +1365,7 @@ void Query_cache::store_query(THD *thd, TABLE_LIST *tables_used)
   const char *query;
   size_t query_length;
   uint8 tables_type;
+  my_hash_value_type hash_value;
   DBUG_ENTER("Query_cache::store_query");
   /*
     Testing 'query_cache_size' without a lock here is safe: the thing
@@ -1470,6 +1471,32 @@ def_week_frmt: %zu, in_trans: %d, autocommit: %d",
                           (int)flags.in_trans,
                           (int)flags.autocommit));
 
+    query=        thd->base_query.ptr();
+    query_length= thd->base_query.length();
+
+    /* Key is query + database + flag */
+    if (thd->db.length)
+    {
+      memcpy((char*) (query + query_length + 1 + QUERY_CACHE_DB_LENGTH_SIZE),
+             thd->db.str, thd->db.length);
+      DBUG_PRINT("qcache", ("database: %s  length: %u",
+			    thd->db.str, (unsigned) thd->db.length));
+    }
+    else
+    {
+      DBUG_PRINT("qcache", ("No active database"));
+    }
+    tot_length= (query_length + thd->db.length + 1 +
+                 QUERY_CACHE_DB_LENGTH_SIZE + QUERY_CACHE_FLAGS_SIZE);
+    /*
+      We should only copy structure (don't use it location directly)
+      because of alignment issue
+    */
+    memcpy((void*) (query + (tot_length - QUERY_CACHE_FLAGS_SIZE)),
+	   &flags, QUERY_CACHE_FLAGS_SIZE);
+    /* See send_result_to_client(): hash the key before locking the cache */
+    hash_value= my_calc_hash(&queries, (uchar*) query, tot_length);
+
     /*
       A table- or a full flush operation can potentially take a long time to
       finish. We choose not to wait for them and skip caching statements
@@ -1497,33 +1524,10 @@ def_week_frmt: %zu, in_trans: %d, autocommit: %d",
       DBUG_VOID_RETURN;
     }
 
-    query=        thd->base_query.ptr();
-    query_length= thd->base_query.length();
-
-    /* Key is query + database + flag */
-    if (thd->db.length)
-    {
-      memcpy((char*) (query + query_length + 1 + QUERY_CACHE_DB_LENGTH_SIZE),
-             thd->db.str, thd->db.length);
-      DBUG_PRINT("qcache", ("database: %s  length: %u",
-			    thd->db.str, (unsigned) thd->db.length));
-    }
-    else
-    {
-      DBUG_PRINT("qcache", ("No active database"));
-    }
-    tot_length= (query_length + thd->db.length + 1 +
-                 QUERY_CACHE_DB_LENGTH_SIZE + QUERY_CACHE_FLAGS_SIZE);
-    /*
-      We should only copy structure (don't use it location directly)
-      because of alignment issue
-    */
-    memcpy((void*) (query + (tot_length - QUERY_CACHE_FLAGS_SIZE)),
-	   &flags, QUERY_CACHE_FLAGS_SIZE);
-
     /* Check if another thread is processing the same query? */
     Query_cache_block *competitor = (Query_cache_block *)
-      my_hash_search(&queries, (uchar*) query, tot_length);
+      my_hash_search_using_hash_value(&queries, hash_value, (uchar*) query,
+                                      tot_length);
     DBUG_PRINT("qcache", ("competitor %p", competitor));
     if (competitor == 0)
     {
@@ -1713,6 +1717,8 @@ Query_cache::send_result_to_client(THD *thd, char *org_sql, uint query_length)
   Query_cache_block_table *block_table, *block_table_end;
   size_t tot_length;
   Query_cache_query_flags flags;
+  Query_cache_block *query_block;
+  my_hash_value_type hash_value;
   const char *sql, *sql_end, *found_brace= 0;
   DBUG_ENTER("Query_cache::send_result_to_client");
 
@@ -1870,22 +1876,11 @@ Query_cache::send_result_to_client(THD *thd, char *org_sql, uint query_length)
     }
   }
   /*
-    Try to obtain an exclusive lock on the query cache. If the cache is
-    disabled or if a full cache flush is in progress, the attempt to
-    get the lock is aborted.
-
-    The TIMEOUT parameter indicate that the lock is allowed to timeout.
+    The key is built in the buffer of the query and hashed before the
+    cache is locked: it depends only on the connection, and computing it
+    inside the critical section would serialize the hashing of the query
+    text of all connections on structure_guard_mutex.
   */
-  if (try_lock(thd, Query_cache::TIMEOUT))
-    goto err;
-
-  if (query_cache_size == 0)
-  {
-    thd->query_cache_is_applicable= 0;            // Query can't be cached
-    goto err_unlock;
-  }
-
-  Query_cache_block *query_block;
   if (thd->variables.query_cache_strip_comments)
   {
     if (found_brace)
@@ -1917,8 +1912,6 @@ Query_cache::send_result_to_client(THD *thd, char *org_sql, uint query_length)
     DBUG_PRINT("qcache", ("No active database"));
   }
 
-  THD_STAGE_INFO(thd, stage_checking_query_cache_for_query);
-
   // fill all gaps between fields with 0 to get repeatable key
   bzero(&flags, QUERY_CACHE_FLAGS_SIZE);
   flags.client_long_flag= MY_TEST(thd->client_capabilities & CLIENT_LONG_FLAG);
@@ -1971,6 +1964,29 @@ def_week_frmt: %zu, in_trans: %d, autocommit: %d",
                           (int)flags.autocommit));
   memcpy((uchar *)(sql + (tot_length - QUERY_CACHE_FLAGS_SIZE)),
 	 (uchar*) &flags, QUERY_CACHE_FLAGS_SIZE);
+  /*
+    Hash the key before locking the cache. The charset of 'queries' is
+    set in init_cache() and never changes, so this is safe without it.
+  */
+  hash_value= my_calc_hash(&queries, (uchar*) sql, tot_length);
+
+  /*
+    Try to obtain an exclusive lock on the query cache. If the cache is
+    disabled or if a full cache flush is in progress, the attempt to
+    get the lock is aborted.
+
+    The TIMEOUT parameter indicate that the lock is allowed to timeout.
+  */
+  if (try_lock(thd, Query_cache::TIMEOUT))
+    goto err;
+
+  if (query_cache_size == 0)
+  {
+    thd->query_cache_is_applicable= 0;            // Query can't be cached
+    goto err_unlock;
+  }
+
+  THD_STAGE_INFO(thd, stage_checking_query_cache_for_query);
 
 #ifdef WITH_WSREP
   bool once_more;
@@ -1978,8 +1994,9 @@ def_week_frmt: %zu, in_trans: %d, autocommit: %d",
 lookup:
 #endif /* WITH_WSREP */
 
-  query_block = (Query_cache_block *)  my_hash_search(&queries, (uchar*) sql,
-                                                      tot_length);
+  query_block= (Query_cache_block *)
+    my_hash_search_using_hash_value(&queries, hash_value, (uchar*) sql,
+                                    tot_length);
   /* Quick abort on unlocked data */
   if (query_block == 0 ||
       query_block->query()->result() == 0 ||
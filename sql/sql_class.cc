@@ -58,6 +58,7 @@
 #include "sp_head.h"
 #include "sp_rcontext.h"
 #include "sp_cache.h"
+#include "sql_prepare.h"                        // text_stmt_cache_clear
 #include "sql_show.h"                           // append_identifier
 #include "transaction.h"
 #include "sql_select.h" /* declares create_tmp_table() */
@@ -869,6 +870,7 @@ THD::THD(my_thread_id id, bool is_wsrep_applier)
   sp_func_cache= NULL;
   sp_package_spec_cache= NULL;
   sp_package_body_cache= NULL;
+  text_stmt_cache= NULL;
 
   /* For user vars replication*/
   if (opt_bin_log)
@@ -1444,6 +1446,7 @@ void THD::change_user(void)
 
   init();
   stmt_map.reset();
+  text_stmt_cache_clear(&text_stmt_cache);
   my_hash_init(key_memory_user_var_entry, &user_vars, system_charset_info,
                USER_VARS_HASH_SIZE, 0, 0, (my_hash_get_key) get_var_key,
                (my_hash_free_key) free_user_var, HASH_THREAD_SPECIFIC);
@@ -1591,6 +1594,7 @@ void THD::cleanup(void)
   auto_inc_intervals_in_cur_stmt_for_binlog.empty();
 
   mysql_ull_cleanup(this);
+  text_stmt_cache_clear(&text_stmt_cache);
   stmt_map.reset();
   /* All metadata locks must have been released by now. */
   DBUG_ASSERT(!mdl_context.has_locks());
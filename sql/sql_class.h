@@ -86,6 +86,7 @@ class Load_log_event;
 class Log_event_writer;
 class sp_rcontext;
 class sp_cache;
+class Text_stmt_cache;
 class Lex_input_stream;
 class Parser_state;
 class Rows_log_event;
@@ -717,6 +718,7 @@ typedef struct system_variables
   ulong progress_report_time;
   ulong completion_type;
   ulong query_cache_type;
+  ulong text_statement_cache_size;
   ulong tx_isolation;
   ulong updatable_views_with_limit;
   ulong alter_algorithm;
@@ -3350,6 +3352,8 @@ class THD: public THD_count, /* this must be first */
   sp_cache   *sp_func_cache;
   sp_cache   *sp_package_spec_cache;
   sp_cache   *sp_package_body_cache;
+  /** Prepared statements for queries of the text protocol */
+  Text_stmt_cache *text_stmt_cache;
 
   /** number of name_const() substitutions, see sp_head.cc:subst_spvars() */
   uint       query_name_consts;
@@ -6035,6 +6039,11 @@ class select_unit :public select_result_interceptor
   }
   virtual void change_select();
   virtual bool force_enable_index_if_needed() { return false; }
+  /*
+    True if rows of the remaining SELECTs can not be part of the result,
+    see select_union_direct
+  */
+  virtual bool is_limit_reached() { return false; }
 };
 
 
@@ -6265,6 +6274,12 @@ class select_union_direct :public select_unit
   bool initialize_tables (JOIN *join);
   bool send_eof();
   bool flush() { return false; }
+  bool is_limit_reached()
+  {
+    /* The limit is set when the first SELECT sends the metadata */
+    return done_send_result_set_metadata && !limit;
+  }
+  bool skip_remaining_selects();
   bool check_simple_select() const
   {
     /* Only called for top-level select_results, usually select_send */
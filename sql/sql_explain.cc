@@ -1658,6 +1658,7 @@ void Explain_rowid_filter::print_explain_json(Explain_query *query,
   Json_writer_nesting_guard guard(writer);
   writer->add_member("rowid_filter").start_object();
   quick->print_json(writer);
+  writer->add_member("container").add_str(container);
   writer->add_member("rows").add_ll(rows);
   writer->add_member("selectivity_pct").add_double(selectivity * 100.0);
   if (is_analyze)
@@ -629,6 +629,9 @@ class Explain_rowid_filter : public Sql_alloc
   /* Expected selectivity for the filter */
   double selectivity;
 
+  /* Type of the container of the filter: "sorted_array" or "bloom_filter" */
+  const char *container;
+
   /* Tracker with the information about how rowid filter is executed */
   Rowid_filter_tracker *tracker;
 
@@ -138,6 +138,16 @@ void Expression_cache_tmptable::init()
     goto error;
   }
 
+  /* Only the result may be a BLOB; heap tables can't index BLOB columns */
+  for (uint i= 1; i < cache_table->s->fields; i++)
+  {
+    if (cache_table->field[i]->flags & BLOB_FLAG)
+    {
+      DBUG_PRINT("error", ("can't index a BLOB parameter"));
+      goto error;
+    }
+  }
+
   field_counter= 1;
 
   if (cache_table->alloc_keys(1) ||
@@ -7830,9 +7830,19 @@ void mysql_parse(THD *thd, char *rawbuf, uint length,
   {
     LEX *lex= thd->lex;
 
-    bool err= parse_sql(thd, parser_state, NULL, true);
+    bool cached= (thd->variables.text_statement_cache_size &&
+                  mysql_text_stmt_cache_execute(thd, rawbuf, length));
+    bool err= !cached && parse_sql(thd, parser_state, NULL, true);
 
-    if (likely(!err))
+    if (cached)
+    {
+      /* Executed by a prepared statement of thd->text_stmt_cache */
+      lex->sql_command= SQLCOM_SELECT;
+      thd->m_statement_psi=
+        MYSQL_REFINE_STATEMENT(thd->m_statement_psi,
+                               sql_statement_info[SQLCOM_SELECT].m_key);
+    }
+    else if (likely(!err))
     {
       thd->m_statement_psi=
         MYSQL_REFINE_STATEMENT(thd->m_statement_psi,
@@ -91,6 +91,7 @@ When one supplies long data for a placeholder:
 #include "set_var.h"
 #include "sql_prepare.h"
 #include "sql_parse.h" // insert_precheck, update_precheck, delete_precheck
+#include "sql_connect.h"                        // check_mqh
 #include "sql_base.h"  // open_normal_and_derived_tables
 #include "sql_cache.h"                          // query_cache_*
 #include "sql_view.h"                          // create_view_precheck
@@ -162,7 +163,8 @@ class Prepared_statement: public Statement
   enum flag_values
   {
     IS_IN_USE= 1,
-    IS_SQL_PREPARE= 2
+    IS_SQL_PREPARE= 2,
+    IS_TEXT_CACHED= 4
   };
 
   THD *thd;
@@ -202,6 +204,8 @@ class Prepared_statement: public Statement
   inline bool is_in_use() { return flags & (uint) IS_IN_USE; }
   inline bool is_sql_prepare() const { return flags & (uint) IS_SQL_PREPARE; }
   void set_sql_prepare() { flags|= (uint) IS_SQL_PREPARE; }
+  inline bool is_text_cached() const { return flags & (uint) IS_TEXT_CACHED; }
+  void set_text_cached() { flags|= (uint) IS_TEXT_CACHED; }
   bool prepare(const char *packet, uint packet_length);
   bool execute_loop(String *expanded_query,
                     bool open_cursor,
@@ -3753,6 +3757,277 @@ void mysql_sql_stmt_close(THD *thd)
 }
 
 
+/**
+  A per-connection cache of prepared SELECT statements, looked up by the
+  exact text of a query received over the text protocol.
+
+  The key is built of the session state that the parser, the name
+  resolution and the items fixed at prepare time depend on, followed by
+  the query text. Like sp_cache, the whole cache is emptied when it grows
+  beyond @@text_statement_cache_size entries, which is the only limit of
+  the cache: its statements do not count towards @@max_prepared_stmt_count.
+*/
+
+class Text_stmt_cache
+{
+public:
+  struct Entry
+  {
+    LEX_CSTRING key;
+    Prepared_statement *stmt;
+  };
+
+  Text_stmt_cache();
+  ~Text_stmt_cache();
+
+  Prepared_statement *lookup(const String *key)
+  {
+    Entry *entry= (Entry*) my_hash_search(&m_hashtable,
+                                          (const uchar*) key->ptr(),
+                                          key->length());
+    return entry ? entry->stmt : NULL;
+  }
+
+  bool insert(const String *key, Prepared_statement *stmt);
+
+  void enforce_limit(ulong upper_limit_for_elements)
+  {
+    if (m_hashtable.records > upper_limit_for_elements)
+      my_hash_reset(&m_hashtable);
+  }
+
+private:
+  HASH m_hashtable;
+};
+
+
+extern "C" uchar *hash_get_key_for_text_stmt(const uchar *ptr, size_t *plen,
+                                             my_bool first);
+extern "C" void hash_free_text_stmt(void *p);
+
+uchar *hash_get_key_for_text_stmt(const uchar *ptr, size_t *plen,
+                                  my_bool first)
+{
+  Text_stmt_cache::Entry *entry= (Text_stmt_cache::Entry*) ptr;
+  *plen= entry->key.length;
+  return (uchar*) entry->key.str;
+}
+
+
+void hash_free_text_stmt(void *p)
+{
+  Text_stmt_cache::Entry *entry= (Text_stmt_cache::Entry*) p;
+  delete entry->stmt;
+  my_free(entry);
+}
+
+
+Text_stmt_cache::Text_stmt_cache()
+{
+  my_hash_init(key_memory_prepared_statement_map, &m_hashtable,
+               &my_charset_bin, 0, 0, 0, hash_get_key_for_text_stmt,
+               hash_free_text_stmt, HASH_THREAD_SPECIFIC);
+}
+
+
+Text_stmt_cache::~Text_stmt_cache()
+{
+  my_hash_free(&m_hashtable);
+}
+
+
+/**
+  Add a prepared statement to the cache.
+
+  The entry and its key are allocated by the cache and not in the memory
+  root of the statement, which is replaced by a reprepare.
+
+  @retval FALSE  ok, the cache owns the statement
+  @retval TRUE   out of memory, the statement is not added
+*/
+
+bool Text_stmt_cache::insert(const String *key, Prepared_statement *stmt)
+{
+  Entry *entry;
+  char *key_str;
+
+  if (!my_multi_malloc(key_memory_prepared_statement_map,
+                       MYF(MY_WME | MY_THREAD_SPECIFIC),
+                       &entry, sizeof(Entry),
+                       &key_str, key->length(),
+                       NullS))
+    return TRUE;
+  memcpy(key_str, key->ptr(), key->length());
+  entry->key.str= key_str;
+  entry->key.length= key->length();
+  entry->stmt= stmt;
+  if (my_hash_insert(&m_hashtable, (uchar*) entry))
+  {
+    my_free(entry);
+    return TRUE;
+  }
+  return FALSE;
+}
+
+
+void text_stmt_cache_clear(Text_stmt_cache **cp)
+{
+  delete *cp;
+  *cp= NULL;
+}
+
+
+/**
+  Check whether the text of a query is a candidate for the statement cache.
+
+  Only single SELECT statements are considered: anything else may change
+  the session or the data, and a ';' may separate several statements.
+*/
+
+static bool text_stmt_is_cacheable(THD *thd, const char *query, uint length)
+{
+  const char *end= query + length;
+  while (query < end && my_isspace(thd->charset(), *query))
+    query++;
+  return end - query > 6 &&
+         !strncasecmp(query, "SELECT", 6) &&
+         (my_isspace(thd->charset(), query[6]) || query[6] == '(') &&
+         !memchr(query, ';', end - query);
+}
+
+
+/*
+  Besides what the parser depends on, the key includes the variables
+  read when items are fixed, like the query cache does in store_query():
+  a cached statement keeps e.g. the precision of 1/3 or the max_length
+  of GROUP_CONCAT() it was prepared with.
+*/
+
+static bool text_stmt_cache_key(THD *thd, const char *query, uint length,
+                                String *key)
+{
+  const SV *sv= &thd->variables;
+  uchar buff[8 + 4 + 4 + 8 + 8 + 8 + 4 + 4 + 8];
+  uchar *pos= buff;
+  int8store(pos, sv->sql_mode); pos+= 8;
+  int4store(pos, sv->character_set_client->number); pos+= 4;
+  int4store(pos, sv->collation_connection->number); pos+= 4;
+  int8store(pos, (ulonglong) sv->div_precincrement); pos+= 8;
+  int8store(pos, (ulonglong) sv->group_concat_max_len); pos+= 8;
+  int8store(pos, (ulonglong) sv->max_sort_length); pos+= 8;
+  int4store(pos, (uint32) sv->default_week_format); pos+= 4;
+  int4store(pos, (uint32) sv->lc_time_names->number); pos+= 4;
+  /* Time_zones live until shutdown, the query cache keys on them too */
+  int8store(pos, (ulonglong) (size_t) sv->time_zone); pos+= 8;
+  DBUG_ASSERT(pos == buff + sizeof(buff));
+  return (key->append((const char*) buff, sizeof(buff)) ||
+          key->append(thd->db.str, thd->db.length) ||
+          key->append('\0') ||
+          key->append(query, length));
+}
+
+
+/**
+  Execute a query of the text protocol with a cached prepared statement.
+
+  On a cache miss the query is prepared and, if it is a SELECT statement
+  without parameter markers, added to the cache of the connection before
+  it is executed. Reprepare on metadata changes is handled by
+  Prepared_statement::execute_loop() like for EXECUTE.
+
+  @param thd     Thread handle
+  @param query   Query text
+  @param length  Length of the query text
+
+  @retval TRUE   the query was executed, the diagnostics area is set
+  @retval FALSE  the query must be parsed and executed the usual way
+*/
+
+bool mysql_text_stmt_cache_execute(THD *thd, const char *query, uint length)
+{
+  CSET_STRING orig_query= thd->query_string;
+  Prepared_statement *stmt;
+  StringBuffer<1024> key;
+  DBUG_ENTER("mysql_text_stmt_cache_execute");
+
+  if (!text_stmt_is_cacheable(thd, query, length) ||
+      text_stmt_cache_key(thd, query, length, &key))
+    DBUG_RETURN(FALSE);
+
+  if (!thd->text_stmt_cache &&
+      !(thd->text_stmt_cache= new Text_stmt_cache()))
+    DBUG_RETURN(FALSE);
+
+  if (!(stmt= thd->text_stmt_cache->lookup(&key)))
+  {
+    if (!(stmt= new Prepared_statement(thd)))
+      DBUG_RETURN(FALSE);
+    stmt->set_sql_prepare();
+    stmt->set_text_cached();
+
+    bool res= stmt->prepare(query, length);
+    /* stmt->prepare() sets thd->query_string, see mysql_sql_stmt_prepare() */
+    thd->set_query(orig_query);
+    if (res || stmt->lex->sql_command != SQLCOM_SELECT || stmt->param_count)
+    {
+      /*
+        Let the parser report the error, if any: the query is executed
+        the usual way.
+      */
+      delete stmt;
+      thd->clear_error();
+      thd->get_stmt_da()->clear_warning_info(thd->query_id);
+      DBUG_RETURN(FALSE);
+    }
+
+    thd->text_stmt_cache->enforce_limit(
+      thd->variables.text_statement_cache_size - 1);
+    if (thd->text_stmt_cache->insert(&key, stmt))
+    {
+      delete stmt;
+      DBUG_RETURN(FALSE);
+    }
+  }
+
+  DBUG_PRINT("info",("stmt: %p", stmt));
+
+#ifndef NO_EMBEDDED_ACCESS_CHECKS
+  /* The resource limits are checked as for a parsed query in mysql_parse() */
+  if (mqh_used && thd->user_connect && check_mqh(thd, SQLCOM_SELECT))
+  {
+    thd->net.error= 0;
+    DBUG_RETURN(TRUE);
+  }
+#endif
+
+  String expanded_query;
+  /* See comments on thd->free_list in mysql_sql_stmt_execute() */
+  Item *free_list_backup= thd->free_list;
+  thd->free_list= NULL;
+  Item_change_list_savepoint change_list_savepoint(thd);
+
+  (void) stmt->execute_loop(&expanded_query, FALSE, NULL, NULL);
+  change_list_savepoint.rollback(thd);
+  thd->free_items();
+  thd->free_list= free_list_backup;
+
+  /*
+    The statement may be evicted from the cache by the next query, so
+    do not leave thd->query_string pointing into its memory root.
+  */
+  thd->set_query(orig_query);
+  stmt->lex->restore_set_statement_var();
+
+  /*
+    A stored function called by the statement may have disabled the
+    cache, which could not be freed while the statement was running.
+  */
+  if (!thd->variables.text_statement_cache_size)
+    text_stmt_cache_clear(&thd->text_stmt_cache);
+  DBUG_RETURN(TRUE);
+}
+
+
 /**
   Handle long data in pieces from client.
 
@@ -4336,7 +4611,7 @@ bool Prepared_statement::prepare(const char *packet, uint packet_len)
       sub-statements inside stored procedures are not logged into
       the general log.
     */
-    if (thd->spcont == NULL)
+    if (thd->spcont == NULL && !is_text_cached())
       general_log_write(thd, COM_STMT_PREPARE, query(), query_length());
   }
   DBUG_RETURN(error);
@@ -4737,6 +5012,8 @@ Prepared_statement::reprepare()
   copy.m_sql_mode= m_sql_mode;
 
   copy.set_sql_prepare(); /* To suppress sending metadata to the client. */
+  if (is_text_cached())
+    copy.set_text_cached();
 
   status_var_increment(thd->status_var.com_stmt_reprepare);
 
@@ -5094,7 +5371,7 @@ bool Prepared_statement::execute(String *expanded_query, bool open_cursor)
     sub-statements inside stored procedures are not logged into
     the general log.
   */
-  if (likely(error == 0 && thd->spcont == NULL))
+  if (likely(error == 0 && thd->spcont == NULL && !is_text_cached()))
     general_log_write(thd, COM_STMT_EXECUTE, thd->query(), thd->query_length());
 
 error:
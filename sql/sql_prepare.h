@@ -23,6 +23,7 @@
 #define STMT_ID_MASK 0x7FFFFFFF
 
 class THD;
+class Text_stmt_cache;
 struct LEX;
 
 /**
@@ -79,6 +80,8 @@ void mysql_sql_stmt_prepare(THD *thd);
 void mysql_sql_stmt_execute(THD *thd);
 void mysql_sql_stmt_execute_immediate(THD *thd);
 void mysql_sql_stmt_close(THD *thd);
+bool mysql_text_stmt_cache_execute(THD *thd, const char *query, uint length);
+void text_stmt_cache_clear(Text_stmt_cache **cp);
 void mysqld_stmt_fetch(THD *thd, char *packet, uint packet_length);
 void mysqld_stmt_reset(THD *thd, char *packet);
 void mysql_stmt_get_longdata(THD *thd, char *pos, ulong packet_length);
@@ -246,6 +246,7 @@ static int remove_dup_with_compare(THD *thd, TABLE *entry, Field **field,
 static int remove_dup_with_hash_index(THD *thd,TABLE *table,
 				      uint field_count, Field **first_field,
 				      ulong key_length,Item *having);
+static bool copy_blobs(Field **ptr);
 static bool cmp_buffer_with_ref(THD *thd, TABLE *table, TABLE_REF *tab_ref);
 static bool setup_new_fields(THD *thd, List<Item> &fields,
 			     List<Item> &all_fields, ORDER *new_order);
@@ -18111,6 +18112,8 @@ class Create_tmp_table: public Data_type_statistics
   ulonglong m_select_options;
   ha_rows m_rows_limit;
   uint m_group_null_items;
+  // a BLOB field holds a value that depends on a window function
+  bool m_window_func_blob;
 
   // counter for distinct/other fields
   uint m_field_count[2];
@@ -18141,6 +18144,7 @@ class Create_tmp_table: public Data_type_statistics
     m_select_options(select_options),
     m_rows_limit(rows_limit),
     m_group_null_items(0),
+    m_window_func_blob(false),
     current_counter(other)
   {
     m_field_count[Create_tmp_table::distinct]= 0;
@@ -18575,6 +18579,8 @@ bool Create_tmp_table::add_fields(THD *thd,
           agg_item->result_field= new_field;
       }
       tmp_from_field++;
+      if (item->with_window_func && (new_field->flags & BLOB_FLAG))
+        m_window_func_blob= true;
 
       uneven_delta= m_uneven_bit_length;
       add_field(table, new_field, fieldnr++, param->force_not_null_cols);
@@ -18636,9 +18642,20 @@ bool Create_tmp_table::finalize(THD *thd,
   DBUG_ASSERT(m_alloced_field_count >= share->fields);
   DBUG_ASSERT(m_alloced_field_count >= share->blob_fields);
 
+  /*
+    HEAP can store BLOB columns of internal temporary tables, but it
+    can't index them.
+    Window function values are saved by updating the rows in place, while
+    the computation holds positions of the rows. A BLOB value that grows
+    could make a HEAP table full, and it can't be moved to disk then.
+  */
+  bool blob_in_key= m_distinct && m_blobs_count[distinct];
+  for (ORDER *ord= m_group; ord && !blob_in_key; ord= ord->next)
+    blob_in_key= (*ord->item)->get_tmp_table_field()->flags & BLOB_FLAG;
+
   /* If result table is small; use a heap */
   /* future: storage engine selection can be made dynamic? */
-  if (share->blob_fields || m_using_unique_constraint
+  if (blob_in_key || m_window_func_blob || m_using_unique_constraint
       || (thd->variables.big_tables && !(m_select_options & SELECT_SMALL_RESULT))
       || (m_select_options & TMP_TABLE_FORCE_MYISAM)
       || thd->variables.tmp_memory_table_size == 0)
@@ -22072,6 +22089,47 @@ end_write(JOIN *join, JOIN_TAB *join_tab __attribute__((unused)),
 }
 
 
+/*
+  @brief
+    Move the group table of end_update() to disk.
+
+  @detail
+    Copies all rows of the HEAP table and then record[0] to an on-disk
+    table, and prepares that for the lookups of end_update().
+
+  @retval
+    FALSE  ok
+  @retval
+    TRUE   error (reported), also when error is not HA_ERR_RECORD_FILE_FULL
+*/
+
+static bool end_update_tmp_table_to_disk(JOIN_TAB *join_tab, int error)
+{
+  TABLE *const table= join_tab->table;
+  if (create_internal_tmp_table_from_heap(join_tab->join->thd, table,
+                                       join_tab->tmp_table_param->start_recinfo,
+                                          &join_tab->tmp_table_param->recinfo,
+                                          error, 0, NULL))
+    return TRUE;                                // Not a table_is_full error
+  if (unlikely((error= table->file->ha_index_init(0, 0))))
+  {
+    table->file->print_error(error, MYF(0));
+    return TRUE;
+  }
+
+  /*
+    Keep looking up the groups by the key of the on-disk table, like
+    for a table that was created on disk from the start. Only if the
+    key had to be replaced by a unique constraint, change the method to
+    update rows: end_unique_update() has to switch between index and
+    rnd_pos() access for every existing group.
+  */
+  if (!table->s->keys || table->s->uniques)
+    join_tab->aggr->set_write_func(end_unique_update);
+  return FALSE;
+}
+
+
 /*
   @brief
     Perform a GROUP BY operation over rows coming in arbitrary order. 
@@ -22125,8 +22183,27 @@ end_update(JOIN *join, JOIN_TAB *join_tab __attribute__((unused)),
     if (unlikely((error= table->file->ha_update_tmp_row(table->record[1],
                                                         table->record[0]))))
     {
-      table->file->print_error(error,MYF(0));	/* purecov: inspected */
-      DBUG_RETURN(NESTED_LOOP_ERROR);            /* purecov: inspected */
+      /*
+        A HEAP table gets full on update when a BLOB value of the group,
+        like MAX() of a TEXT column, grows. Replace the old row by the
+        updated one while moving the table to disk. The BLOB values of
+        record[0] may still point into the old row, so copy them first.
+      */
+      if (error != HA_ERR_RECORD_FILE_FULL ||
+          table->s->db_type() != heap_hton)
+      {
+        table->file->print_error(error,MYF(0));	/* purecov: inspected */
+        DBUG_RETURN(NESTED_LOOP_ERROR);          /* purecov: inspected */
+      }
+      if (unlikely(copy_blobs(table->field)))
+        DBUG_RETURN(NESTED_LOOP_ERROR);
+      if (unlikely((error= table->file->ha_delete_tmp_row(table->record[1]))))
+      {
+        table->file->print_error(error, MYF(0));
+        DBUG_RETURN(NESTED_LOOP_ERROR);
+      }
+      if (end_update_tmp_table_to_disk(join_tab, HA_ERR_RECORD_FILE_FULL))
+        DBUG_RETURN(NESTED_LOOP_ERROR);
     }
     goto end;
   }
@@ -22135,22 +22212,9 @@ end_update(JOIN *join, JOIN_TAB *join_tab __attribute__((unused)),
   if (unlikely(copy_funcs(join_tab->tmp_table_param->items_to_copy,
                           join->thd)))
     DBUG_RETURN(NESTED_LOOP_ERROR);           /* purecov: inspected */
-  if (unlikely((error= table->file->ha_write_tmp_row(table->record[0]))))
-  {
-    if (create_internal_tmp_table_from_heap(join->thd, table,
-                                       join_tab->tmp_table_param->start_recinfo,
-                                            &join_tab->tmp_table_param->recinfo,
-                                            error, 0, NULL))
-      DBUG_RETURN(NESTED_LOOP_ERROR);            // Not a table_is_full error
-    /* Change method to update rows */
-    if (unlikely((error= table->file->ha_index_init(0, 0))))
-    {
-      table->file->print_error(error, MYF(0));
-      DBUG_RETURN(NESTED_LOOP_ERROR);
-    }
-
-    join_tab->aggr->set_write_func(end_unique_update);
-  }
+  if (unlikely((error= table->file->ha_write_tmp_row(table->record[0]))) &&
+      end_update_tmp_table_to_disk(join_tab, error))
+    DBUG_RETURN(NESTED_LOOP_ERROR);
   join_tab->send_records++;
 end:
   if (unlikely(join->thd->check_killed()))
@@ -23981,8 +24045,8 @@ JOIN_TAB::remove_duplicates()
     thd->reset_killed();
 
   table->file->info(HA_STATUS_VARIABLE);
-  if (table->s->db_type() == heap_hton ||
-      (!table->s->blob_fields &&
+  if (!table->s->blob_fields &&
+      (table->s->db_type() == heap_hton ||
        ((ALIGN_SIZE(keylength) + HASH_OVERHEAD) * table->file->stats.records <
 	thd->variables.sortbuff_size)))
     error=remove_dup_with_hash_index(join->thd, table, field_count, first_field,
@@ -26520,6 +26584,9 @@ bool JOIN_TAB::save_explain_data(Explain_table_access *eta,
     erf->quick= quick->get_explain(thd->mem_root);
     erf->selectivity= range_rowid_filter_info->selectivity;
     erf->rows= quick->records;
+    erf->container=
+      rowid_filter->get_container()->get_type() == BLOOM_FILTER_CONTAINER ?
+      "bloom_filter" : "sorted_array";
     if (!(erf->tracker= new Rowid_filter_tracker(thd->lex->analyze_stmt)))
       return 1;
     rowid_filter->set_tracker(erf->tracker);
@@ -178,7 +178,8 @@ TABLE_FIELD_TYPE column_stat_fields[COLUMN_STAT_N_FIELDS] =
   },
   {
     { STRING_WITH_LEN("hist_type") },
-    { STRING_WITH_LEN("enum('SINGLE_PREC_HB','DOUBLE_PREC_HB')") },
+    { STRING_WITH_LEN("enum('SINGLE_PREC_HB','DOUBLE_PREC_HB',"
+                      "'DOUBLE_PREC_MCV_HB')") },
     { STRING_WITH_LEN("utf8") }
   },
   {
@@ -1538,6 +1539,51 @@ class Histogram_builder
   /* number of distinct values that occured only once  */
   ulonglong count_distinct_single_occurence;
 
+  /* The most common values seen so far, for DOUBLE_PREC_MCV_HB histograms */
+  struct Common_value
+  {
+    ulonglong count;
+    double pos;
+  } mcv[HIST_MCV_MAX_VALUES];
+  uint mcv_slots;          /* number of slots for the most common values   */
+  uint mcv_count;          /* number of values in mcv[]                    */
+
+  static int mcv_cmp_by_pos(const void *a, const void *b)
+  {
+    double pos_a= ((const Common_value *) a)->pos;
+    double pos_b= ((const Common_value *) b)->pos;
+    return pos_a < pos_b ? -1 : (pos_a > pos_b ? 1 : 0);
+  }
+
+  /*
+    Remember the value elem occuring elem_cnt times if it is among the
+    mcv_slots most common values seen so far. Values occuring only once
+    are not considered common.
+  */
+  void add_common_value(void *elem, element_count elem_cnt)
+  {
+    uint i= mcv_count;
+    if (elem_cnt < 2)
+      return;
+    if (mcv_count == mcv_slots)
+    {
+      uint min= 0;
+      for (i= 1; i < mcv_count; i++)
+      {
+        if (mcv[i].count < mcv[min].count)
+          min= i;
+      }
+      if (mcv[min].count >= elem_cnt)
+        return;
+      i= min;
+    }
+    else
+      mcv_count++;
+    column->store_field_value((uchar *) elem, col_length);
+    mcv[i].count= elem_cnt;
+    mcv[i].pos= column->pos_in_interval(min_value, max_value);
+  }
+
 public: 
   Histogram_builder(Field *col, uint col_len, ha_rows rows)
     : column(col), col_length(col_len), records(rows)
@@ -1546,12 +1592,15 @@ class Histogram_builder
     min_value= col_stats->min_value;
     max_value= col_stats->max_value;
     histogram= &col_stats->histogram;
+    histogram->init_mcv_slots();
     hist_width= histogram->get_width();
     bucket_capacity= (double) records / (hist_width + 1);
     curr_bucket= 0;
     count= 0;
     count_distinct= 0;
     count_distinct_single_occurence= 0;
+    mcv_slots= histogram->get_mcv_slots();
+    mcv_count= 0;
   }
 
   ulonglong get_count_distinct() const { return count_distinct; }
@@ -1566,6 +1615,8 @@ class Histogram_builder
     if (elem_cnt == 1)
       count_distinct_single_occurence++;
     count+= elem_cnt;
+    if (mcv_slots)
+      add_common_value(elem, elem_cnt);
     if (curr_bucket == hist_width)
       return 0;
     if (count > bucket_capacity * (curr_bucket + 1))
@@ -1583,6 +1634,19 @@ class Histogram_builder
     }
     return 0;
   }
+
+  /*
+    Store the most common values into the histogram ordered by their
+    positions. Must be called after all values have been walked through.
+  */
+  void finalize()
+  {
+    if (!mcv_count)
+      return;
+    my_qsort(mcv, mcv_count, sizeof(Common_value), mcv_cmp_by_pos);
+    for (uint i= 0; i < mcv_count; i++)
+      histogram->set_mcv_value(i, mcv[i].pos, (double) mcv[i].count / records);
+  }
 };
 
 
@@ -1701,6 +1765,7 @@ class Count_distinct_field: public Sql_alloc
   {
     Histogram_builder hist_builder(table_field, tree_key_length, rows);
     tree->walk(table_field->table,  histogram_build_walk, (void *) &hist_builder);
+    hist_builder.finalize();
     distincts= hist_builder.get_count_distinct();
     distincts_single_occurence= hist_builder.get_count_single_occurence();
   }
@@ -2667,12 +2732,15 @@ int collect_statistics_for_table(THD *thd, TABLE *table)
 
   restore_record(table, s->default_values);
 
-  /* Perform a full table scan to collect statistics on 'table's columns */
-  if (!(rc= file->ha_rnd_init(TRUE)))
+  /*
+    Scan a sample of the table to collect statistics on 'table's columns.
+    The engine decides how the sample is taken; it may skip whole pages.
+  */
+  if (!(rc= file->ha_sample_init(sample_fraction)))
   {
     DEBUG_SYNC(table->in_use, "statistics_collection_start");
 
-    while ((rc= file->ha_rnd_next(table->record[0])) != HA_ERR_END_OF_FILE)
+    while ((rc= file->ha_sample_next(table->record[0])) != HA_ERR_END_OF_FILE)
     {
       if (thd->killed)
         break;
@@ -2680,22 +2748,19 @@ int collect_statistics_for_table(THD *thd, TABLE *table)
       if (rc)
         break;
 
-      if (thd_rnd(thd) <= sample_fraction)
+      for (field_ptr= table->field; *field_ptr; field_ptr++)
       {
-        for (field_ptr= table->field; *field_ptr; field_ptr++)
-        {
-          table_field= *field_ptr;
-          if (!bitmap_is_set(table->read_set, table_field->field_index))
-            continue;
-          if ((rc= table_field->collected_stats->add()))
-            break;
-        }
-        if (rc)
+        table_field= *field_ptr;
+        if (!bitmap_is_set(table->read_set, table_field->field_index))
+          continue;
+        if ((rc= table_field->collected_stats->add()))
           break;
-        rows++;
       }
+      if (rc)
+        break;
+      rows++;
     }
-    file->ha_rnd_end();
+    file->ha_sample_end();
   }
   rc= (rc == HA_ERR_END_OF_FILE && !thd->killed) ? 0 : 1;
 
@@ -3881,6 +3946,9 @@ double get_column_range_cardinality(Field *field,
 double Histogram::point_selectivity(double pos, double avg_sel)
 {
   double sel;
+  if (mcv_point_selectivity(pos, avg_sel, &sel))
+    return sel;
+
   /* Find the bucket that contains the value 'pos'. */
   uint min= find_bucket(pos, TRUE);
   uint pos_value= (uint) (pos * prec_factor());
@@ -3959,6 +4027,63 @@ double Histogram::point_selectivity(double pos, double avg_sel)
   return sel;
 }
 
+
+/*
+  Estimate selectivity of "col=const" using the most common values list
+
+  @param pos      Position of the "const" between column's min_value and
+                  max_value
+  @param avg_sel  Average selectivity of condition "col=const" in this table
+  @param sel  OUT Expected condition selectivity
+
+  @details
+    If the value is in the list its fraction of rows is returned. Otherwise
+    the rows not taken by the common values are assumed to be spread evenly
+    over the remaining distinct values, the number of which is derived from
+    avg_sel. A value that is not in the list is not expected to be more
+    frequent than the least common value of the list.
+
+  @retval
+    TRUE   sel is set
+    FALSE  the histogram has no common values, use the buckets
+*/
+
+bool Histogram::mcv_point_selectivity(double pos, double avg_sel, double *sel)
+{
+  uint slots= get_mcv_slots();
+  uint pos_value= (uint) (pos * prec_factor());
+  double inv_prec_factor= (double) 1.0 / prec_factor();
+  double found= 0.0, total= 0.0, least= 1.0;
+  uint common_values= 0;
+
+  for (uint i= 0; i < slots; i++)
+  {
+    const uchar *slot= values + 1 + i * HIST_MCV_SLOT_SIZE;
+    double frac= uint2korr(slot + 2) * inv_prec_factor;
+    if (!frac)
+      continue;
+    common_values++;
+    total+= frac;
+    set_if_smaller(least, frac);
+    /* Different values may share a position, sum them up as buckets do */
+    if (uint2korr(slot) == pos_value)
+      found+= frac;
+  }
+  if (!common_values)
+    return FALSE;
+
+  if (found)
+    *sel= found;
+  else
+  {
+    double other_values= 1.0 / avg_sel - common_values;
+    set_if_bigger(other_values, 1.0);
+    *sel= MY_MAX(1.0 - total, 0.0) / other_values;
+    set_if_smaller(*sel, least);
+  }
+  return TRUE;
+}
+
 /*
   Check whether the table is one of the persistent statistical tables.
 */
@@ -42,7 +42,8 @@ typedef
 enum enum_histogram_type
 {
   SINGLE_PREC_HB,
-  DOUBLE_PREC_HB
+  DOUBLE_PREC_HB,
+  DOUBLE_PREC_MCV_HB
 } Histogram_type;
 
 enum enum_stat_tables
@@ -140,6 +141,21 @@ double get_column_range_cardinality(Field *field,
 bool is_stat_table(const LEX_CSTRING *db, LEX_CSTRING *table);
 bool is_eits_usable(Field* field);
 
+/*
+  A histogram of the type DOUBLE_PREC_MCV_HB starts with a list of the most
+  common values of the column followed by a DOUBLE_PREC_HB histogram:
+
+    byte 0      number of slots in the list (HIST_MCV_MAX_VALUES at most)
+    then        for each slot the position of the value (as for the bucket
+                bounds) and the fraction of the non-NULL rows with this
+                value, both stored as 2 bytes scaled to 0..(1 << 16) - 1.
+                Unused slots have a zero fraction.
+    then        the bucket bounds of the height-balanced histogram
+*/
+
+#define HIST_MCV_MAX_VALUES 16
+#define HIST_MCV_SLOT_SIZE  4
+
 class Histogram
 {
 
@@ -154,11 +170,20 @@ class Histogram
     case SINGLE_PREC_HB:
       return ((uint) (1 << 8) - 1);
     case DOUBLE_PREC_HB:
+    case DOUBLE_PREC_MCV_HB:
       return ((uint) (1 << 16) - 1);
     }
     return 1;
   }
 
+  /* The bucket bounds of the height-balanced histogram */
+  uchar *get_buckets()
+  {
+    if (type == DOUBLE_PREC_MCV_HB)
+      return values + 1 + get_mcv_slots() * HIST_MCV_SLOT_SIZE;
+    return values;
+  }
+
 public:
   uint get_width()
   {
@@ -167,6 +192,10 @@ class Histogram
       return size;
     case DOUBLE_PREC_HB:
       return size / 2;
+    case DOUBLE_PREC_MCV_HB:
+      if (!size)
+        return 0;
+      return (size - 1 - get_mcv_slots() * HIST_MCV_SLOT_SIZE) / 2;
     }
     return 0;
   }
@@ -180,6 +209,8 @@ class Histogram
       return (uint) (((uint8 *) values)[i]);
     case DOUBLE_PREC_HB:
       return (uint) uint2korr(values + i * 2);
+    case DOUBLE_PREC_MCV_HB:
+      return (uint) uint2korr(get_buckets() + i * 2);
     }
     return 0;
   }
@@ -237,7 +268,32 @@ class Histogram
 
   void set_values (uchar *vals) { values= (uchar *) vals; }
 
-  bool is_available() { return get_size() > 0 && get_values(); }
+  bool is_available() { return get_size() > 0 && get_values() && get_width(); }
+
+  /*
+    Reserve the slots for the most common values in a histogram that is
+    to be built. Must be called before get_width() is used for it.
+  */
+  void init_mcv_slots()
+  {
+    if (type == DOUBLE_PREC_MCV_HB && size)
+      values[0]= (uchar) MY_MIN(HIST_MCV_MAX_VALUES,
+                                (size - 1) / (2 * HIST_MCV_SLOT_SIZE));
+  }
+
+  /* Number of slots in the list of the most common values */
+  uint get_mcv_slots()
+  {
+    return type == DOUBLE_PREC_MCV_HB && size ? (uint) values[0] : 0;
+  }
+
+  void set_mcv_value(uint i, double pos, double frac)
+  {
+    DBUG_ASSERT(i < get_mcv_slots());
+    uchar *slot= values + 1 + i * HIST_MCV_SLOT_SIZE;
+    int2store(slot, pos * prec_factor());
+    int2store(slot + 2, frac * prec_factor());
+  }
 
   void set_value(uint i, double val)
   {
@@ -248,6 +304,9 @@ class Histogram
     case DOUBLE_PREC_HB:
       int2store(values + i * 2, val * prec_factor());
       return;
+    case DOUBLE_PREC_MCV_HB:
+      int2store(get_buckets() + i * 2, val * prec_factor());
+      return;
     }
   }
 
@@ -260,6 +319,12 @@ class Histogram
     case DOUBLE_PREC_HB:
       int2store(values + i * 2, uint2korr(values + i * 2 - 2));
       return;
+    case DOUBLE_PREC_MCV_HB:
+    {
+      uchar *buckets= get_buckets();
+      int2store(buckets + i * 2, uint2korr(buckets + i * 2 - 2));
+      return;
+    }
     }
   }
 
@@ -277,6 +342,9 @@ class Histogram
     Estimate selectivity of "col=const" using a histogram
   */
   double point_selectivity(double pos, double avg_sel);
+
+private:
+  bool mcv_point_selectivity(double pos, double avg_sel, double *sel);
 };
 
 
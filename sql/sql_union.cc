@@ -1026,6 +1026,23 @@ bool select_union_direct::send_eof()
 }
 
 
+/**
+  Finish the result when the SELECTs after the current one are not
+  executed because the global LIMIT has been reached.
+
+  @retval FALSE Success
+  @retval TRUE  Error
+*/
+
+bool select_union_direct::skip_remaining_selects()
+{
+  thd->lex->current_select= last_select_lex;
+  /* The skipped SELECTs found no rows */
+  thd->limit_found_rows= 0;
+  return send_eof();
+}
+
+
 /*
   initialization procedures before fake_select_lex preparation()
 
@@ -2167,6 +2184,19 @@ bool st_select_lex_unit::exec()
     for (SELECT_LEX *sl= select_cursor; sl; sl= sl->next_select())
     {
       ha_rows records_at_start= 0;
+      if (sl != select_cursor && union_result &&
+          union_result->is_limit_reached() &&
+          !found_rows_for_union && !thd->lex->analyze_stmt)
+      {
+        /*
+          UNION ALL sends its rows directly and all rows allowed by the
+          global LIMIT have been sent: the remaining SELECTs can't add
+          anything to the result, so they are not executed.
+        */
+        saved_error= static_cast<select_union_direct*>(union_result)->
+                       skip_remaining_selects();
+        break;
+      }
       thd->lex->current_select= sl;
       if (union_result)
         union_result->change_select();
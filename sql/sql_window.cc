@@ -2740,7 +2740,10 @@ bool save_window_function_values(List<Item_window_func>& window_functions,
 
   int err= tbl->file->ha_update_row(tbl->record[1], tbl->record[0]);
   if (err && err != HA_ERR_RECORD_IS_THE_SAME)
+  {
+    tbl->file->print_error(err, MYF(0));
     return true;
+  }
 
   return false;
 }
@@ -2833,6 +2836,7 @@ bool compute_window_func(THD *thd,
     iter_cursor_managers.rewind();
 
     Group_bound_tracker *tracker;
+    uint funcs_left= window_functions.elements;
     while ((win_func= iter_win_funcs++) &&
            (tracker= iter_part_trackers++) &&
            (cursor_manager= iter_cursor_managers++))
@@ -2856,8 +2860,10 @@ bool compute_window_func(THD *thd,
 
 
       /* Return to current row after notifying cursors for each window
-         function. */
-      tbl->file->ha_rnd_pos(tbl->record[0], rowid_buf);
+         function. save_window_function_values() does it after the last
+         one. */
+      if (--funcs_left)
+        tbl->file->ha_rnd_pos(tbl->record[0], rowid_buf);
     }
 
     /* We now have computed values for each window function. They can now
@@ -2936,6 +2942,10 @@ bool Window_func_runner::add_function_to_run(Item_window_func *win_func)
       my_error(ER_NOT_SUPPORTED_YET, MYF(0),
                "COUNT(DISTINCT) aggregate as window function");
       return true;
+    case Item_sum::APPROX_COUNT_DISTINCT_FUNC:
+      my_error(ER_NOT_SUPPORTED_YET, MYF(0),
+               "APPROX_COUNT_DISTINCT() aggregate as window function");
+      return true;
     case Item_sum::JSON_ARRAYAGG_FUNC:
       my_error(ER_NOT_SUPPORTED_YET, MYF(0),
                "JSON_ARRAYAGG() aggregate as window function");
@@ -441,6 +441,7 @@ End SQL_MODE_ORACLE_SPECIFIC */
 %token  <kwd> ALTER                         /* SQL-2003-R */
 %token  <kwd> ANALYZE_SYM
 %token  <kwd> AND_SYM                       /* SQL-2003-R */
+%token  <kwd> APPROX_COUNT_DISTINCT_SYM
 %token  <kwd> ASC                           /* SQL-2003-N */
 %token  <kwd> ASENSITIVE_SYM                /* FUTURE-USE */
 %token  <kwd> AS                            /* SQL-2003-R */
@@ -10765,6 +10766,12 @@ sum_expr:
             if (unlikely($$ == NULL))
               MYSQL_YYABORT;
           }
+        | APPROX_COUNT_DISTINCT_SYM '(' in_sum_expr ')'
+          {
+            $$= new (thd->mem_root) Item_sum_approx_count_distinct(thd, $3);
+            if (unlikely($$ == NULL))
+              MYSQL_YYABORT;
+          }
         | BIT_AND  '(' in_sum_expr ')'
           {
             $$= new (thd->mem_root) Item_sum_and(thd, $3);
@@ -15869,6 +15876,7 @@ reserved_keyword_udt_not_param_type:
         | ALTER
         | ANALYZE_SYM
         | AND_SYM
+        | APPROX_COUNT_DISTINCT_SYM
         | AS
         | ASC
         | ASENSITIVE_SYM
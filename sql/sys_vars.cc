@@ -52,6 +52,7 @@
 #include <myisam.h>
 #include "debug_sync.h"                         // DEBUG_SYNC
 #include "sql_show.h"
+#include "sql_prepare.h"                        // text_stmt_cache_clear
 #include "opt_trace_context.h"
 
 #include "log_event.h"
@@ -4005,6 +4006,16 @@ Sys_threadpool_dedicated_listener(
   GLOBAL_VAR(threadpool_dedicated_listener), CMD_LINE(OPT_ARG), DEFAULT(FALSE),
   NO_MUTEX_GUARD, NOT_IN_BINLOG
 );
+
+static Sys_var_on_access_global<Sys_var_mybool,
+                                PRIV_SET_SYSTEM_GLOBAL_VAR_THREAD_POOL>
+Sys_threadpool_work_stealing(
+  "thread_pool_work_stealing",
+  "If set to 1, a worker thread that has nothing to do takes over "
+  "connections queued in another thread group whose workers are all busy",
+  GLOBAL_VAR(threadpool_work_stealing), CMD_LINE(OPT_ARG), DEFAULT(FALSE),
+  NO_MUTEX_GUARD, NOT_IN_BINLOG
+);
 #endif /* HAVE_POOL_OF_THREADS */
 
 /**
@@ -6156,6 +6167,30 @@ static Sys_var_ulong Sys_sp_cache_size(
        GLOBAL_VAR(stored_program_cache_size), CMD_LINE(REQUIRED_ARG),
        VALID_RANGE(0, 512 * 1024), DEFAULT(256), BLOCK_SIZE(1));
 
+static bool fix_text_statement_cache_size(sys_var *self, THD *thd,
+                                          enum_var_type type)
+{
+  /*
+    Free the statements when the cache is disabled. A statement of the
+    cache may be running if this is set in a stored function, then the
+    cache is freed after the statement by mysql_text_stmt_cache_execute().
+  */
+  if (type != OPT_GLOBAL && !thd->variables.text_statement_cache_size &&
+      !thd->in_sub_stmt)
+    text_stmt_cache_clear(&thd->text_stmt_cache);
+  return false;
+}
+static Sys_var_ulong Sys_text_statement_cache_size(
+       "text_statement_cache_size",
+       "The soft upper limit for number of SELECT statements sent as text "
+       "that one connection keeps prepared, to skip parsing and name "
+       "resolution when the same query text is sent again. "
+       "0 disables the cache",
+       SESSION_VAR(text_statement_cache_size), CMD_LINE(REQUIRED_ARG),
+       VALID_RANGE(0, 512 * 1024), DEFAULT(0), BLOCK_SIZE(1),
+       NO_MUTEX_GUARD, NOT_IN_BINLOG, ON_CHECK(0),
+       ON_UPDATE(fix_text_statement_cache_size));
+
 export const char *plugin_maturity_names[]=
 { "unknown", "experimental", "alpha", "beta", "gamma", "stable", 0 };
 static Sys_var_enum Sys_plugin_maturity(
@@ -6415,7 +6450,9 @@ static Sys_var_enum Sys_histogram_type(
        "Specifies type of the histograms created by ANALYZE. "
        "Possible values are: "
        "SINGLE_PREC_HB - single precision height-balanced, "
-       "DOUBLE_PREC_HB - double precision height-balanced.",
+       "DOUBLE_PREC_HB - double precision height-balanced, "
+       "DOUBLE_PREC_MCV_HB - double precision height-balanced with "
+       "a list of the most common values.",
        SESSION_VAR(histogram_type), CMD_LINE(REQUIRED_ARG),
        histogram_types, DEFAULT(1));
 
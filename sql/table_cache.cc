@@ -61,32 +61,60 @@ static std::atomic<bool> tc_contention_warning_reported;
 
 /** Data collections. */
 static LF_HASH tdc_hash; /**< Collection of TABLE_SHARE objects. */
-/** Collection of unused TABLE_SHARE objects. */
-static
-I_P_List <TDC_element,
-          I_P_List_adapter<TDC_element, &TDC_element::next, &TDC_element::prev>,
-          I_P_List_null_counter,
-          I_P_List_fast_push_back<TDC_element> > unused_shares;
+
+/**
+  Collection of unused TABLE_SHARE objects.
+
+  The collection is partitioned by the hash value of the table key, so
+  that threads acquiring and releasing shares of different tables do not
+  contend on one mutex. Each partition is in LRU order, and tdc_purge()
+  evicts from the partitions in turn, which approximates a global LRU.
+*/
+struct Unused_shares_instance
+{
+  /**
+    Protects unused shares list.
+
+    TDC_element::prev
+    TDC_element::next
+    list
+  */
+  mysql_mutex_t LOCK_unused_shares;
+  I_P_List <TDC_element,
+            I_P_List_adapter<TDC_element, &TDC_element::next,
+                             &TDC_element::prev>,
+            I_P_List_null_counter,
+            I_P_List_fast_push_back<TDC_element> > list;
+  /** Avoid false sharing between instances */
+  char pad[CPU_LEVEL1_DCACHE_LINESIZE];
+};
+
+#define TDC_UNUSED_INSTANCES 16
+static Unused_shares_instance unused_shares[TDC_UNUSED_INSTANCES];
+/** Partition that tdc_purge() evicts from next */
+static std::atomic<uint32_t> unused_shares_purge_pos;
 
 static bool tdc_inited;
 
 
-/**
-  Protects unused shares list.
+static uint tdc_unused_instance(const char *key, uint key_length)
+{
+  return my_hash_sort(&my_charset_bin, (const uchar*) key, key_length) %
+         TDC_UNUSED_INSTANCES;
+}
 
-  TDC_element::prev
-  TDC_element::next
-  unused_shares
-*/
 
-static mysql_mutex_t LOCK_unused_shares;
+static inline Unused_shares_instance *unused_shares_of(TDC_element *element)
+{
+  return &unused_shares[element->m_unused_instance];
+}
 
 #ifdef HAVE_PSI_INTERFACE
 static PSI_mutex_key key_LOCK_unused_shares, key_TABLE_SHARE_LOCK_table_share,
                      key_LOCK_table_cache;
 static PSI_mutex_info all_tc_mutexes[]=
 {
-  { &key_LOCK_unused_shares, "LOCK_unused_shares", PSI_FLAG_GLOBAL },
+  { &key_LOCK_unused_shares, "LOCK_unused_shares", 0 },
   { &key_TABLE_SHARE_LOCK_table_share, "TABLE_SHARE::tdc.LOCK_table_share", 0 },
   { &key_LOCK_table_cache, "LOCK_table_cache", 0 }
 };
@@ -570,6 +598,8 @@ static void tdc_hash_initializer(LF_HASH *,
 {
   memcpy(element->m_key, key->str, key->length);
   element->m_key_length= (uint)key->length;
+  element->m_unused_instance= tdc_unused_instance(key->str,
+                                                  element->m_key_length);
   tdc_assert_clean_share(element);
 }
 
@@ -597,8 +627,9 @@ bool tdc_init(void)
   if (!(tc= new Table_cache_instance[tc_instances + 1]))
     DBUG_RETURN(true);
   tdc_inited= true;
-  mysql_mutex_init(key_LOCK_unused_shares, &LOCK_unused_shares,
-                   MY_MUTEX_INIT_FAST);
+  for (uint i= 0; i < TDC_UNUSED_INSTANCES; i++)
+    mysql_mutex_init(key_LOCK_unused_shares,
+                     &unused_shares[i].LOCK_unused_shares, MY_MUTEX_INIT_FAST);
   lf_hash_init(&tdc_hash, sizeof(TDC_element) +
                           sizeof(Share_free_tables) * (tc_instances - 1),
                LF_HASH_UNIQUE, 0, 0,
@@ -648,7 +679,8 @@ void tdc_deinit(void)
   {
     tdc_inited= false;
     lf_hash_destroy(&tdc_hash);
-    mysql_mutex_destroy(&LOCK_unused_shares);
+    for (uint i= 0; i < TDC_UNUSED_INSTANCES; i++)
+      mysql_mutex_destroy(&unused_shares[i].LOCK_unused_shares);
     delete [] tc;
   }
   DBUG_VOID_RETURN;
@@ -672,14 +704,20 @@ void tdc_purge(bool all)
   DBUG_ENTER("tdc_purge");
   while (all || tdc_records() > tdc_size)
   {
-    TDC_element *element;
+    TDC_element *element= 0;
+    Unused_shares_instance *unused;
 
-    mysql_mutex_lock(&LOCK_unused_shares);
-    if (!(element= unused_shares.pop_front()))
+    for (uint i= 0; !element && i < TDC_UNUSED_INSTANCES; i++)
     {
-      mysql_mutex_unlock(&LOCK_unused_shares);
-      break;
+      unused= &unused_shares[unused_shares_purge_pos.fetch_add(1,
+                               std::memory_order_relaxed) %
+                             TDC_UNUSED_INSTANCES];
+      mysql_mutex_lock(&unused->LOCK_unused_shares);
+      if (!(element= unused->list.pop_front()))
+        mysql_mutex_unlock(&unused->LOCK_unused_shares);
     }
+    if (!element)
+      break;
 
     /* Concurrent thread may start using share again, reset prev and next. */
     element->prev= 0;
@@ -688,10 +726,10 @@ void tdc_purge(bool all)
     if (element->ref_count)
     {
       mysql_mutex_unlock(&element->LOCK_table_share);
-      mysql_mutex_unlock(&LOCK_unused_shares);
+      mysql_mutex_unlock(&unused->LOCK_unused_shares);
       continue;
     }
-    mysql_mutex_unlock(&LOCK_unused_shares);
+    mysql_mutex_unlock(&unused->LOCK_unused_shares);
 
     tdc_delete_share_from_hash(element);
   }
@@ -907,7 +945,8 @@ TABLE_SHARE *tdc_acquire_share(THD *thd, TABLE_LIST *tl, uint flags,
   mysql_mutex_unlock(&element->LOCK_table_share);
   if (was_unused)
   {
-    mysql_mutex_lock(&LOCK_unused_shares);
+    Unused_shares_instance *unused= unused_shares_of(element);
+    mysql_mutex_lock(&unused->LOCK_unused_shares);
     if (element->prev)
     {
       /*
@@ -915,11 +954,11 @@ TABLE_SHARE *tdc_acquire_share(THD *thd, TABLE_LIST *tl, uint flags,
         Unlink share from this list
       */
       DBUG_PRINT("info", ("Unlinking from not used list"));
-      unused_shares.remove(element);
+      unused->list.remove(element);
       element->next= 0;
       element->prev= 0;
     }
-    mysql_mutex_unlock(&LOCK_unused_shares);
+    mysql_mutex_unlock(&unused->LOCK_unused_shares);
   }
 
 end:
@@ -970,28 +1009,29 @@ void tdc_release_share(TABLE_SHARE *share)
   }
   mysql_mutex_unlock(&share->tdc->LOCK_table_share);
 
-  mysql_mutex_lock(&LOCK_unused_shares);
+  Unused_shares_instance *unused= unused_shares_of(share->tdc);
+  mysql_mutex_lock(&unused->LOCK_unused_shares);
   mysql_mutex_lock(&share->tdc->LOCK_table_share);
   if (--share->tdc->ref_count)
   {
     if (!share->is_view)
       mysql_cond_broadcast(&share->tdc->COND_release);
     mysql_mutex_unlock(&share->tdc->LOCK_table_share);
-    mysql_mutex_unlock(&LOCK_unused_shares);
+    mysql_mutex_unlock(&unused->LOCK_unused_shares);
     DBUG_VOID_RETURN;
   }
   if (share->tdc->flushed || tdc_records() > tdc_size)
   {
-    mysql_mutex_unlock(&LOCK_unused_shares);
+    mysql_mutex_unlock(&unused->LOCK_unused_shares);
     tdc_delete_share_from_hash(share->tdc);
     DBUG_VOID_RETURN;
   }
   /* Link share last in used_table_share list */
   DBUG_PRINT("info", ("moving share to unused list"));
   DBUG_ASSERT(share->tdc->next == 0);
-  unused_shares.push_back(share->tdc);
+  unused->list.push_back(share->tdc);
   mysql_mutex_unlock(&share->tdc->LOCK_table_share);
-  mysql_mutex_unlock(&LOCK_unused_shares);
+  mysql_mutex_unlock(&unused->LOCK_unused_shares);
   DBUG_VOID_RETURN;
 }
 
@@ -1024,35 +1064,41 @@ void tdc_remove_referenced_share(THD *thd, TABLE_SHARE *share)
 void tdc_remove_table(THD *thd, const char *db, const char *table_name)
 {
   TDC_element *element;
+  char key[MAX_DBKEY_LENGTH];
   DBUG_ENTER("tdc_remove_table");
   DBUG_PRINT("enter", ("name: %s", table_name));
 
   DBUG_ASSERT(thd->mdl_context.is_lock_owner(MDL_key::TABLE, db, table_name,
                                              MDL_EXCLUSIVE));
 
-  mysql_mutex_lock(&LOCK_unused_shares);
+  /* The partition must be locked before the share, see tdc_release_share() */
+  Unused_shares_instance *unused=
+    &unused_shares[tdc_unused_instance(key,
+                                       tdc_create_key(key, db, table_name))];
+  mysql_mutex_lock(&unused->LOCK_unused_shares);
   if (!(element= tdc_lock_share(thd, db, table_name)))
   {
-    mysql_mutex_unlock(&LOCK_unused_shares);
+    mysql_mutex_unlock(&unused->LOCK_unused_shares);
     DBUG_VOID_RETURN;
   }
 
   DBUG_ASSERT(element != MY_ERRPTR); // What can we do about it?
+  DBUG_ASSERT(unused == unused_shares_of(element));
 
   if (!element->ref_count)
   {
     if (element->prev)
     {
-      unused_shares.remove(element);
+      unused->list.remove(element);
       element->prev= 0;
       element->next= 0;
     }
-    mysql_mutex_unlock(&LOCK_unused_shares);
+    mysql_mutex_unlock(&unused->LOCK_unused_shares);
 
     tdc_delete_share_from_hash(element);
     DBUG_VOID_RETURN;
   }
-  mysql_mutex_unlock(&LOCK_unused_shares);
+  mysql_mutex_unlock(&unused->LOCK_unused_shares);
 
   element->ref_count++;
   mysql_mutex_unlock(&element->LOCK_table_share);
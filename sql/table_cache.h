@@ -31,6 +31,7 @@ struct TDC_element
 {
   uchar m_key[NAME_LEN + 1 + NAME_LEN + 1];
   uint m_key_length;
+  uint m_unused_instance;                /* Partition of unused shares */
   bool flushed;
   TABLE_SHARE *share;
 
@@ -159,6 +159,16 @@ static void print_pool_blocked_message(bool);
  io_poll_associate_fd() was called.
  On Linux : epoll_ctl(..EPOLL_CTL_MOD)
 
+ Descriptors are registered as one-shot, and start_io() re-arms them
+ after every request. This costs a system call per request, but it is
+ what guarantees that an event is delivered only after the worker
+ thread is done with the connection: only one thread handles a
+ connection at a time, and a connection is never freed while an event
+ for it may still be harvested by a concurrent io_poll_wait().
+ A persistent (multishot) registration would need to replace both
+ guarantees, with an ownership flag in the connection and deferred
+ freeing of closed connections.
+
  - io_poll_wait (TP_file_handle pollfd, native_event *native_events, int maxevents,
    int timeout_ms)
 
@@ -1134,6 +1144,83 @@ static bool too_many_threads(thread_group_t *thread_group)
 }
 
 
+/*
+  Check whether the events queued in a group should be taken over by
+  another group: no worker is waiting to pick them up, and the group is
+  not allowed to run more active threads.
+*/
+
+static bool is_group_overloaded(thread_group_t *thread_group)
+{
+  return (!is_queue_empty(thread_group) &&
+          thread_group->waiting_threads.is_empty() &&
+          thread_group->active_thread_count >=
+            1 + (int) threadpool_oversubscribe);
+}
+
+
+/**
+  Take over a queued connection from an overloaded group.
+
+  This is the last thing an idle worker tries before going to sleep.
+  Groups are scanned starting from the next one, so that idle groups
+  help different neighbours. The caller holds the mutex of its own group,
+  thus mutexes of other groups are only tried, never waited for.
+
+  The connection migrates to the group of the worker, like in
+  change_group(): it is removed from the poll descriptor of the old group,
+  and start_io() binds it to the poll descriptor of the new one.
+
+  @param thread_group - group of the current worker, locked
+
+  @return stolen connection, or NULL
+*/
+
+static TP_connection_generic *steal_event(thread_group_t *thread_group)
+{
+  DBUG_ENTER("steal_event");
+  mysql_mutex_assert_owner(&thread_group->mutex);
+
+  uint n= group_count;
+  uint own= (uint) (thread_group - all_groups);
+  for (uint i= 1; i <= n; i++)
+  {
+    thread_group_t *group= &all_groups[(own + i) % n];
+    /*
+      Testing without a lock is safe here: at worst, a connection is
+      not stolen, or the test is repeated under the lock.
+    */
+    if (group == thread_group || !is_group_overloaded(group) ||
+        mysql_mutex_trylock(&group->mutex))
+      continue;
+
+    TP_connection_generic *c= NULL;
+    if (!group->shutdown && is_group_overloaded(group))
+    {
+      for (int prio= 0; prio < NQUEUES && !c; prio++)
+        c= group->queues[prio].pop_front();
+      DBUG_ASSERT(c);
+      if (c->bound_to_poll_descriptor)
+      {
+        io_poll_disassociate_fd(group->pollfd, c->fd);
+        c->bound_to_poll_descriptor= false;
+      }
+      group->connection_count--;
+    }
+    mysql_mutex_unlock(&group->mutex);
+
+    if (c)
+    {
+      c->thread_group= thread_group;
+      thread_group->connection_count++;
+      TP_INCREMENT_GROUP_COUNTER(thread_group, steals);
+      DBUG_RETURN(c);
+    }
+  }
+  DBUG_RETURN(NULL);
+}
+
+
 /**
   Retrieve a connection with pending event.
 
@@ -1214,6 +1301,14 @@ TP_connection_generic *get_event(worker_thread_t *current_thread,
       }
     }
 
+    /* Help a group whose workers are all busy */
+    if (!oversubscribed && threadpool_work_stealing)
+    {
+      connection= steal_event(thread_group);
+      if (connection)
+        break;
+    }
+
 
     /* And now, finally sleep */
     current_thread->woken = false; /* wake() sets this to true */
@@ -611,6 +611,7 @@ static int heap_prepare_hp_create_info(TABLE *table_arg, bool internal_table,
   ha_rows max_rows;
   HP_KEYDEF *keydef;
   HA_KEYSEG *seg;
+  HP_BLOB_DESC *blob_descs;
   bool found_real_auto_increment= 0;
 
   bzero(hp_create_info, sizeof(*hp_create_info));
@@ -622,6 +623,7 @@ static int heap_prepare_hp_create_info(TABLE *table_arg, bool internal_table,
                        MYF(MY_WME | MY_THREAD_SPECIFIC),
                        &keydef, keys * sizeof(HP_KEYDEF),
                        &seg, parts * sizeof(HA_KEYSEG),
+                       &blob_descs, share->blob_fields * sizeof(HP_BLOB_DESC),
                        NULL))
     return my_errno;
   for (key= 0; key < keys; key++)
@@ -651,6 +653,8 @@ static int heap_prepare_hp_create_info(TABLE *table_arg, bool internal_table,
     for (; key_part != key_part_end; key_part++, seg++)
     {
       Field *field= key_part->field;
+      /* BLOB values are stored outside of the record; they can't be keys */
+      DBUG_ASSERT(!(field->flags & BLOB_FLAG));
 
       if (pos->algorithm == HA_KEY_ALG_BTREE)
 	seg->type= field->key_type();
@@ -716,6 +720,27 @@ static int heap_prepare_hp_create_info(TABLE *table_arg, bool internal_table,
   hp_create_info->auto_key= auto_key;
   hp_create_info->auto_key_type= auto_key_type;
   hp_create_info->max_table_size=current_thd->variables.max_heap_table_size;
+
+  /*
+    Only internal temporary tables can have BLOB columns. Their values are
+    not included in mem_per_row, so limit the total size of the table by
+    tmp_memory_table_size as well, to get the table converted to an on-disk
+    one in time.
+  */
+  for (uint i= 0; i < share->blob_fields; i++)
+  {
+    Field_blob *blob= (Field_blob*) table_arg->field[share->blob_field[i]];
+    blob_descs[i].offset= (uint) blob->offset(table_arg->record[0]);
+    blob_descs[i].packlength= blob->pack_length_no_ptr();
+  }
+  if (share->blob_fields)
+  {
+    DBUG_ASSERT(internal_table);
+    set_if_smaller(hp_create_info->max_table_size,
+                   current_thd->variables.tmp_memory_table_size);
+  }
+  hp_create_info->blob_descs= blob_descs;
+  hp_create_info->blobs= share->blob_fields;
   hp_create_info->with_auto_increment= found_real_auto_increment;
   hp_create_info->internal_table= internal_table;
 
@@ -100,6 +100,12 @@ extern void hp_clear(HP_SHARE *info);
 extern void hp_clear_keys(HP_SHARE *info);
 extern uint hp_rb_pack_key(HP_KEYDEF *keydef, uchar *key, const uchar *old,
                            key_part_map keypart_map);
+extern int hp_blob_alloc(HP_SHARE *share, const uchar *record,
+                         const uchar *replaced, uchar **chunk);
+extern void hp_blob_link(HP_SHARE *share, uchar *pos, uchar *chunk);
+extern uchar *hp_blob_chunk(HP_SHARE *share, const uchar *pos);
+extern void hp_blob_free(HP_SHARE *share, const uchar *record, uchar *chunk);
+extern void hp_blob_free_all(HP_SHARE *share);
 
 extern mysql_mutex_t THR_LOCK_heap;
 
@@ -107,6 +113,7 @@ extern PSI_memory_key hp_key_memory_HP_SHARE;
 extern PSI_memory_key hp_key_memory_HP_INFO;
 extern PSI_memory_key hp_key_memory_HP_PTRS;
 extern PSI_memory_key hp_key_memory_HP_KEYDEF;
+extern PSI_memory_key hp_key_memory_HP_BLOB;
 
 #ifdef HAVE_PSI_INTERFACE
 void init_heap_psi_keys();
@@ -0,0 +1,199 @@
+/* Copyright (c) 2020, MariaDB Corporation.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; version 2 of the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1335  USA */
+
+/*
+  Storage of BLOB columns in internal temporary tables.
+
+  The fixed-size record stored in HP_BLOCK contains, for every BLOB column,
+  the length of the value and a pointer to it, just like the record buffer
+  of the server. The values of all BLOB columns of one row are copied into
+  one separately allocated chunk, so that the row only owns a single
+  allocation no matter how many BLOB columns it has. The chunk is found
+  from the pointer of the first non-empty BLOB column of the stored row.
+
+  BLOB columns can not be part of any key of a HEAP table.
+*/
+
+#include "heapdef.h"
+
+static inline size_t hp_blob_length(const HP_BLOB_DESC *desc,
+                                    const uchar *record)
+{
+  const uchar *pos= record + desc->offset;
+  switch (desc->packlength) {
+  case 1:
+    return (size_t) *pos;
+  case 2:
+    return (size_t) uint2korr(pos);
+  case 3:
+    return (size_t) uint3korr(pos);
+  case 4:
+    return (size_t) uint4korr(pos);
+  }
+  DBUG_ASSERT(0);
+  return 0;
+}
+
+
+static inline uchar *hp_blob_ptr(const HP_BLOB_DESC *desc,
+                                 const uchar *record)
+{
+  uchar *ptr;
+  memcpy(&ptr, record + desc->offset + desc->packlength, sizeof ptr);
+  return ptr;
+}
+
+
+/*
+  Copy the BLOB values of a record into a newly allocated chunk
+
+  SYNOPSIS
+    hp_blob_alloc()
+    share     Heap table share
+    record    Record whose BLOB values are to be copied
+    replaced  Stored row whose chunk will be freed once the copy is
+              linked in (heap_update()), or NULL
+    chunk     OUT: the copy, or NULL if all BLOB values are empty
+
+  NOTE
+    The size of the chunk is accounted in share->data_length, so that
+    it counts towards max_table_size. The chunk of 'replaced' is still
+    accounted there, so only the growth over it is checked against the
+    limit: an update that does not make the BLOB values longer never
+    fails with HA_ERR_RECORD_FILE_FULL.
+
+  RETURN
+    0                      ok
+    HA_ERR_RECORD_FILE_FULL the table would grow beyond max_table_size
+    HA_ERR_OUT_OF_MEM      out of memory
+*/
+
+int hp_blob_alloc(HP_SHARE *share, const uchar *record,
+                  const uchar *replaced, uchar **chunk)
+{
+  const HP_BLOB_DESC *desc, *end= share->blob_descs + share->blobs;
+  size_t length= 0, replaced_length= 0;
+  uchar *to;
+  DBUG_ENTER("hp_blob_alloc");
+
+  for (desc= share->blob_descs; desc < end; desc++)
+    length+= hp_blob_length(desc, record);
+
+  *chunk= NULL;
+  if (!length)
+    DBUG_RETURN(0);
+
+  if (replaced)
+  {
+    for (desc= share->blob_descs; desc < end; desc++)
+      replaced_length+= hp_blob_length(desc, replaced);
+  }
+  if (length > replaced_length &&
+      share->data_length + share->index_length + length - replaced_length >
+      share->max_table_size)
+  {
+    DBUG_PRINT("error", ("record file full. blob length: %zu", length));
+    DBUG_RETURN(my_errno= HA_ERR_RECORD_FILE_FULL);
+  }
+
+  if (!(to= (uchar*) my_malloc(hp_key_memory_HP_BLOB, length,
+                               MYF(MY_WME | (share->internal ?
+                                             MY_THREAD_SPECIFIC : 0)))))
+    DBUG_RETURN(my_errno= HA_ERR_OUT_OF_MEM);
+
+  *chunk= to;
+  for (desc= share->blob_descs; desc < end; desc++)
+  {
+    size_t blob_length= hp_blob_length(desc, record);
+    if (blob_length)
+    {
+      memcpy(to, hp_blob_ptr(desc, record), blob_length);
+      to+= blob_length;
+    }
+  }
+  share->data_length+= length;
+  DBUG_RETURN(0);
+}
+
+
+/*
+  Make the BLOB columns of a stored row point into the chunk that was
+  returned by hp_blob_alloc() for the same values.
+*/
+
+void hp_blob_link(HP_SHARE *share, uchar *pos, uchar *chunk)
+{
+  const HP_BLOB_DESC *desc, *end= share->blob_descs + share->blobs;
+
+  for (desc= share->blob_descs; desc < end; desc++)
+  {
+    size_t blob_length= hp_blob_length(desc, pos);
+    if (blob_length)
+    {
+      memcpy(pos + desc->offset + desc->packlength, &chunk, sizeof chunk);
+      chunk+= blob_length;
+    }
+  }
+}
+
+
+/* Return the chunk that holds the BLOB values of a stored row */
+
+uchar *hp_blob_chunk(HP_SHARE *share, const uchar *pos)
+{
+  const HP_BLOB_DESC *desc, *end= share->blob_descs + share->blobs;
+
+  for (desc= share->blob_descs; desc < end; desc++)
+    if (hp_blob_length(desc, pos))
+      return hp_blob_ptr(desc, pos);
+  return NULL;
+}
+
+
+/*
+  Free a chunk of BLOB values
+
+  SYNOPSIS
+    hp_blob_free()
+    share     Heap table share
+    record    Record with the BLOB lengths that chunk was allocated for
+    chunk     Chunk returned by hp_blob_alloc() or hp_blob_chunk(), or NULL
+*/
+
+void hp_blob_free(HP_SHARE *share, const uchar *record, uchar *chunk)
+{
+  const HP_BLOB_DESC *desc, *end= share->blob_descs + share->blobs;
+
+  if (!chunk)
+    return;
+  for (desc= share->blob_descs; desc < end; desc++)
+    share->data_length-= hp_blob_length(desc, record);
+  my_free(chunk);
+}
+
+
+/* Free the BLOB values of all rows; used when the table is emptied */
+
+void hp_blob_free_all(HP_SHARE *share)
+{
+  ulong pos, end= share->records + share->deleted;
+
+  for (pos= 0; pos < end; pos++)
+  {
+    uchar *record= hp_find_block(&share->block, pos);
+    if (record[share->visible])
+      my_free(hp_blob_chunk(share, record));
+  }
+}
@@ -31,6 +31,8 @@ void hp_clear(HP_SHARE *info)
 {
   DBUG_ENTER("hp_clear");
 
+  if (info->blobs)
+    hp_blob_free_all(info);
   if (info->block.levels)
     (void) hp_free_level(&info->block,info->block.levels,info->block.root,
 			(uchar*) 0);
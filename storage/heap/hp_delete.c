@@ -42,6 +42,9 @@ int heap_delete(HP_INFO *info, const uchar *record)
       goto err;
   }
 
+  if (share->blobs)
+    hp_blob_free(share, pos, hp_blob_chunk(share, pos));
+
   info->update=HA_STATE_DELETED;
   *((uchar**) pos)=share->del_link;
   share->del_link=pos;
@@ -33,7 +33,7 @@ static HASH_INFO *hp_find_free_hash(HP_SHARE *info, HP_BLOCK *block,
 int heap_write(HP_INFO *info, const uchar *record)
 {
   HP_KEYDEF *keydef, *end;
-  uchar *pos;
+  uchar *pos, *blob_chunk= NULL;
   HP_SHARE *share=info->s;
   DBUG_ENTER("heap_write");
 #ifndef DBUG_OFF
@@ -46,6 +46,9 @@ int heap_write(HP_INFO *info, const uchar *record)
     DBUG_RETURN(my_errno);
   share->changed=1;
 
+  if (share->blobs && hp_blob_alloc(share, record, NULL, &blob_chunk))
+    goto err_blob;
+
   for (keydef = share->keydef, end = keydef + share->keys; keydef < end;
        keydef++)
   {
@@ -54,6 +57,8 @@ int heap_write(HP_INFO *info, const uchar *record)
   }
 
   memcpy(pos,record,(size_t) share->reclength);
+  if (blob_chunk)
+    hp_blob_link(share, pos, blob_chunk);
   pos[share->visible]= 1;                     /* Mark record as not deleted */
   if (++share->records == share->blength)
     share->blength+= share->blength;
@@ -86,7 +91,9 @@ int heap_write(HP_INFO *info, const uchar *record)
       break;
     keydef--;
   } 
+  hp_blob_free(share, record, blob_chunk);
 
+err_blob:
   share->deleted++;
   *((uchar**) pos)=share->del_link;
   share->del_link=pos;
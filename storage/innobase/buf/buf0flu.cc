@@ -127,7 +127,7 @@ static void buf_flush_validate_skip()
 #endif /* UNIV_DEBUG */
 
 /** Wake up the page cleaner if needed */
-inline void buf_pool_t::page_cleaner_wakeup()
+void buf_pool_t::page_cleaner_wakeup()
 {
   if (page_cleaner_idle() &&
       (srv_max_dirty_pages_pct_lwm == 0.0 ||
@@ -140,17 +140,19 @@ inline void buf_pool_t::page_cleaner_wakeup()
   }
 }
 
-/** Insert a modified block into the flush list.
+/** Insert a modified block into the flush list, while the caller is
+holding buf_pool.flush_list_mutex. The caller is responsible for invoking
+buf_pool.page_cleaner_wakeup() before releasing the mutex.
 @param[in,out]	block	modified block
 @param[in]	lsn	oldest modification */
-void buf_flush_insert_into_flush_list(buf_block_t* block, lsn_t lsn)
+void buf_flush_insert_into_flush_list_low(buf_block_t* block, lsn_t lsn)
 {
 	mysql_mutex_assert_not_owner(&buf_pool.mutex);
 	mysql_mutex_assert_owner(&log_sys.flush_order_mutex);
+	mysql_mutex_assert_owner(&buf_pool.flush_list_mutex);
 	ut_ad(lsn);
 	ut_ad(!fsp_is_system_temporary(block->page.id().space()));
 
-	mysql_mutex_lock(&buf_pool.flush_list_mutex);
 	block->page.set_oldest_modification(lsn);
 	MEM_CHECK_DEFINED(block->page.zip.data
 			  ? block->page.zip.data : block->frame,
@@ -160,6 +162,15 @@ void buf_flush_insert_into_flush_list(buf_block_t* block, lsn_t lsn)
 
 	UT_LIST_ADD_FIRST(buf_pool.flush_list, &block->page);
 	ut_d(buf_flush_validate_skip());
+}
+
+/** Insert a modified block into the flush list.
+@param[in,out]	block	modified block
+@param[in]	lsn	oldest modification */
+void buf_flush_insert_into_flush_list(buf_block_t* block, lsn_t lsn)
+{
+	mysql_mutex_lock(&buf_pool.flush_list_mutex);
+	buf_flush_insert_into_flush_list_low(block, lsn);
 	buf_pool.page_cleaner_wakeup();
 	mysql_mutex_unlock(&buf_pool.flush_list_mutex);
 }
@@ -82,9 +82,10 @@ bool fil_space_t::try_to_close(bool print_info)
     }
 
     /* We are using an approximation of LRU replacement policy. In
-    fil_node_open_file_low(), newly opened files are moved to the end
-    of fil_system.space_list, so that they would be less likely to be
-    closed here. */
+    fil_node_open_file_low(), newly opened files are moved after the
+    other opened files in fil_system.space_list, so that they would be
+    less likely to be closed here. Closed files are moved to the end,
+    so that they will not be scanned again. */
     fil_node_t *node= UT_LIST_GET_FIRST(space->chain);
     ut_ad(node);
     ut_ad(!UT_LIST_GET_NEXT(chain, node));
@@ -105,6 +106,7 @@ bool fil_space_t::try_to_close(bool print_info)
     }
 
     node->close();
+    fil_system.move_closed_last_to_space_list(space);
     return true;
   }
 
@@ -347,6 +349,7 @@ fil_node_t* fil_space_t::add(const char* name, pfs_os_file_t handle,
 	UT_LIST_ADD_LAST(chain, node);
 	if (node->is_open()) {
 		n_pending.fetch_and(~CLOSING, std::memory_order_relaxed);
+		fil_system.move_opened_last_to_space_list(this);
 		if (++fil_system.n_open >= srv_max_n_open_files) {
 			reacquire();
 			try_to_close(true);
@@ -405,13 +408,10 @@ static bool fil_node_open_file_low(fil_node_t *node)
 
   ut_ad(node->is_open());
 
-  if (UNIV_LIKELY(!fil_system.freeze_space_list))
-  {
-    /* Move the file last in fil_system.space_list, so that
-    fil_space_t::try_to_close() should close it as a last resort. */
-    UT_LIST_REMOVE(fil_system.space_list, node->space);
-    UT_LIST_ADD_LAST(fil_system.space_list, node->space);
-  }
+  /* Move the file after the other opened files in
+  fil_system.space_list, so that fil_space_t::try_to_close()
+  should close it as a last resort. */
+  fil_system.move_opened_last_to_space_list(node->space);
 
   fil_system.n_open++;
   return true;
@@ -789,6 +789,8 @@ std::vector<pfs_os_file_t> fil_system_t::detach(fil_space_t *space,
     space->is_in_rotation_list= false;
     rotation_list.remove(*space);
   }
+  if (space == space_list_last_opened)
+    space_list_last_opened= UT_LIST_GET_PREV(space_list, space);
   UT_LIST_REMOVE(space_list, space);
   if (space == sys_space)
     sys_space= nullptr;
@@ -1283,6 +1285,7 @@ void fil_system_t::close()
   ut_ad(this == &fil_system);
   ut_a(unflushed_spaces.empty());
   ut_a(!UT_LIST_GET_LEN(space_list));
+  ut_ad(!space_list_last_opened);
   ut_ad(!sys_space);
   ut_ad(!temp_space);
 
@@ -2555,6 +2555,28 @@ ha_innobase::check_if_supported_inplace_alter(
 			    : HA_ALTER_INPLACE_COPY_LOCK);
 	}
 
+	/* Adding secondary indexes to an empty table only needs to
+	create the empty index trees. When ALGORITHM=INSTANT or
+	LOCK=EXCLUSIVE was requested, skip the MDL downgrade and the
+	online build phase; concurrent access is blocked anyway and
+	the build will be trivial. If the table is filled before
+	prepare_inplace_alter_table() acquires the exclusive MDL, the
+	indexes will be built while holding it. By default the MDL is
+	still downgraded, so that concurrent reads are not blocked. */
+	const Alter_info* alter_info = ha_alter_info->alter_info;
+	if (online
+	    && (alter_info->algorithm(m_user_thd)
+		== Alter_info::ALTER_TABLE_ALGORITHM_INSTANT
+		|| alter_info->requested_lock
+		== Alter_info::ALTER_TABLE_LOCK_EXCLUSIVE)
+	    && !(ha_alter_info->handler_flags
+		 & ~(INNOBASE_ONLINE_CREATE | INNOBASE_INPLACE_IGNORE))
+	    && m_prebuilt->table->space
+	    && m_prebuilt->table->is_readable()
+	    && innobase_table_is_empty(m_prebuilt->table)) {
+		DBUG_RETURN(HA_ALTER_INPLACE_INSTANT);
+	}
+
 	if (ha_alter_info->unsupported_reason) {
 	} else if (ha_alter_info->handler_flags & INNOBASE_ONLINE_CREATE) {
 		ha_alter_info->unsupported_reason = "ADD INDEX";
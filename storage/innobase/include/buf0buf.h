@@ -1876,7 +1876,7 @@ class buf_pool_t
     return page_cleaner_is_idle;
   }
   /** Wake up the page cleaner if needed */
-  inline void page_cleaner_wakeup();
+  void page_cleaner_wakeup();
 
   /** Register whether an explicit wakeup of the page cleaner is needed */
   void page_cleaner_set_idle(bool deep_sleep)
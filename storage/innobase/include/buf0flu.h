@@ -119,8 +119,11 @@ buf_flush_note_modification(
 	buf_block_t*	block,		/*!< in: block which is modified */
 	lsn_t		start_lsn,	/*!< in: start lsn of the first mtr in a
 					set of mtr's */
-	lsn_t		end_lsn);	/*!< in: end lsn of the last mtr in the
+	lsn_t		end_lsn,	/*!< in: end lsn of the last mtr in the
 					set of mtr's */
+	bool		flush_list_locked = false);
+					/*!< in: whether the caller holds
+					buf_pool.flush_list_mutex */
 
 /** Initialize page_cleaner. */
 ATTRIBUTE_COLD void buf_flush_page_cleaner_init();
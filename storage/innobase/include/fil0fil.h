@@ -1432,11 +1432,47 @@ struct fil_system_t {
 					startup we scan the data dictionary
 					and set here the maximum of the
 					space id's of the tables there */
-  /** nonzero if fil_node_open_file_low() should avoid moving the tablespace
-  to the end of space_list, for FIFO policy of try_to_close() */
+  /** nonzero if fil_node_open_file_low() and try_to_close() should avoid
+  moving tablespaces in space_list, for FIFO policy of try_to_close() */
   ulint freeze_space_list;
 	UT_LIST_BASE_NODE_T(fil_space_t) space_list;
 					/*!< list of all file spaces */
+  /** the most recently opened tablespace in space_list; the spaces
+  preceding it were opened in least recently used order, and closed
+  spaces follow it; protected by mutex */
+  fil_space_t *space_list_last_opened= nullptr;
+
+  /** Move a tablespace whose file was opened after the other
+  opened tablespaces in space_list, so that fil_space_t::try_to_close()
+  would close it as a last resort.
+  @param space  tablespace whose file was opened */
+  void move_opened_last_to_space_list(fil_space_t *space)
+  {
+    mysql_mutex_assert_owner(&mutex);
+    if (UNIV_UNLIKELY(freeze_space_list) || space == space_list_last_opened)
+      return;
+    UT_LIST_REMOVE(space_list, space);
+    if (space_list_last_opened)
+      UT_LIST_INSERT_AFTER(space_list, space_list_last_opened, space);
+    else
+      UT_LIST_ADD_FIRST(space_list, space);
+    space_list_last_opened= space;
+  }
+
+  /** Move a tablespace whose file was closed to the end of space_list,
+  so that fil_space_t::try_to_close() will not have to skip it while
+  looking for an open file among hundreds of thousands of tablespaces.
+  @param space  tablespace whose file was closed */
+  void move_closed_last_to_space_list(fil_space_t *space)
+  {
+    mysql_mutex_assert_owner(&mutex);
+    if (UNIV_UNLIKELY(freeze_space_list))
+      return;
+    if (space == space_list_last_opened)
+      space_list_last_opened= UT_LIST_GET_PREV(space_list, space);
+    UT_LIST_REMOVE(space_list, space);
+    UT_LIST_ADD_LAST(space_list, space);
+  }
 	UT_LIST_BASE_NODE_T(fil_space_t) named_spaces;
 					/*!< list of all file spaces
 					for which a FILE_MODIFY
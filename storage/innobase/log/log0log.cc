@@ -774,6 +774,14 @@ bool log_write_lock_own()
 /** Ensure that the log has been written to the log file up to a given
 log entry (such as that of a transaction commit). Start a new write, or
 wait and check if an already running write is covering the request.
+
+By default, the flush_lock is acquired first and held for both the write
+and the flush, so that the next group cannot be written before the
+previous one was made durable. With innodb_log_write_pipelined=ON, the
+write is performed before waiting for flush_lock, so that the next group
+is written while the previous one is being flushed, and the next flush
+will cover all groups that were written meanwhile. The setting is ignored
+if the log file writes are durable (O_DSYNC or persistent memory).
 @param[in]	lsn		log sequence number that should be
 included in the redo log file write
 @param[in]	flush_to_disk	whether the written log should also
@@ -791,7 +799,13 @@ void log_write_up_to(lsn_t lsn, bool flush_to_disk, bool rotate_key)
     return;
   }
 
-  if (flush_to_disk &&
+  /* With durable writes, log_write() advances the flushed lsn itself
+  while another thread could be flushing an older write_lsn under
+  flush_lock only. There is no separate flush to overlap with anyway. */
+  const bool pipelined= srv_log_write_pipelined &&
+    !log_sys.log.writes_are_durable();
+
+  if (flush_to_disk && !pipelined &&
     flush_lock.acquire(lsn) != group_commit_lock::ACQUIRED)
   {
     return;
@@ -814,6 +828,12 @@ void log_write_up_to(lsn_t lsn, bool flush_to_disk, bool rotate_key)
     return;
   }
 
+  if (pipelined && flush_lock.acquire(lsn) != group_commit_lock::ACQUIRED)
+  {
+    /* Another thread flushed our write. */
+    return;
+  }
+
   /* Flush the highest written lsn.*/
   auto flush_lsn = write_lock.value();
   flush_lock.set_pending(flush_lsn);
@@ -1254,6 +1274,19 @@ log_print(
 			log_sys.n_log_ios - log_sys.n_log_ios_old)
 		/ time_elapsed);
 
+	const ulint	n_write_groups = write_lock.groups();
+	const ulint	n_flush_groups = flush_lock.groups();
+
+	fprintf(file,
+		ULINTPF " log write groups, %.2f waiters/group; "
+		ULINTPF " log flush groups, %.2f waiters/group\n",
+		n_write_groups,
+		static_cast<double>(write_lock.grouped())
+		/ static_cast<double>(std::max<ulint>(n_write_groups, 1)),
+		n_flush_groups,
+		static_cast<double>(flush_lock.grouped())
+		/ static_cast<double>(std::max<ulint>(n_flush_groups, 1)));
+
 	log_sys.n_log_ios_old = log_sys.n_log_ios;
 	log_sys.last_printout_time = current_time;
 
@@ -165,7 +165,8 @@ struct group_commit_waiter_t
 };
 
 group_commit_lock::group_commit_lock() :
-  m_mtx(), m_value(0), m_pending_value(0), m_lock(false), m_waiters_list()
+  m_mtx(), m_value(0), m_pending_value(0), m_lock(false), m_waiters_list(),
+  m_groups(0), m_grouped(0)
 {
 }
 
@@ -263,10 +264,13 @@ void group_commit_lock::release(value_type num)
   group_commit_waiter_t* cur, * prev, * next;
   group_commit_waiter_t* wakeup_list = nullptr;
   int extra_wake = 0;
+  ulint grouped = 0;
 
   for (prev= nullptr, cur= m_waiters_list; cur; cur= next)
   {
     next= cur->m_next;
+    if (cur->m_value <= num)
+      grouped++;
     if (cur->m_value <= num || extra_wake++ == 0)
     {
       /* Move current waiter to wakeup_list*/
@@ -291,6 +295,8 @@ void group_commit_lock::release(value_type num)
       prev= cur;
     }
   }
+  m_groups.fetch_add(1, std::memory_order_relaxed);
+  m_grouped.fetch_add(grouped, std::memory_order_relaxed);
   lk.unlock();
 
   for (cur= wakeup_list; cur; cur= next)
@@ -51,6 +51,10 @@ Operations supported on this semaphore
 - read pending value
 
 5. set_pending_value()
+
+6. groups(), grouped()
+- statistics: number of release() calls, and the number of waiters
+  whose request was satisfied by them
 */
 class group_commit_lock
 {
@@ -63,6 +67,11 @@ class group_commit_lock
   std::atomic<value_type> m_pending_value;
   bool m_lock;
   group_commit_waiter_t* m_waiters_list;
+  /** number of release() calls */
+  std::atomic<ulint> m_groups;
+  /** number of waiters released by release() because their
+  request was covered */
+  std::atomic<ulint> m_grouped;
 public:
   group_commit_lock();
   enum lock_return_code
@@ -75,6 +84,8 @@ class group_commit_lock
   value_type value() const;
   value_type pending() const;
   void set_pending(value_type num);
+  ulint groups() const { return m_groups.load(std::memory_order_relaxed); }
+  ulint grouped() const { return m_grouped.load(std::memory_order_relaxed); }
 #ifndef DBUG_OFF
   bool is_owner();
 #endif
@@ -317,14 +317,18 @@ struct DebugCheck {
 struct ReleaseBlocks
 {
   const lsn_t start, end;
+  /** whether buf_pool.flush_list_mutex is being held */
+  const bool flush_list_locked;
 #ifdef UNIV_DEBUG
   const mtr_buf_t &memo;
 
-  ReleaseBlocks(lsn_t start, lsn_t end, const mtr_buf_t &memo) :
-    start(start), end(end), memo(memo)
+  ReleaseBlocks(lsn_t start, lsn_t end, bool flush_list_locked,
+                const mtr_buf_t &memo) :
+    start(start), end(end), flush_list_locked(flush_list_locked), memo(memo)
 #else /* UNIV_DEBUG */
-  ReleaseBlocks(lsn_t start, lsn_t end, const mtr_buf_t&) :
-    start(start), end(end)
+  ReleaseBlocks(lsn_t start, lsn_t end, bool flush_list_locked,
+                const mtr_buf_t&) :
+    start(start), end(end), flush_list_locked(flush_list_locked)
 #endif /* UNIV_DEBUG */
   {
     ut_ad(start);
@@ -346,7 +350,7 @@ struct ReleaseBlocks
     }
 
     buf_flush_note_modification(static_cast<buf_block_t*>(slot->object),
-                                start, end);
+                                start, end, flush_list_locked);
     return true;
   }
 };
@@ -440,11 +444,22 @@ void mtr_t::commit()
     else
       ut_ad(!m_freed_space);
 
+    /* Insert all newly dirtied blocks into buf_pool.flush_list while
+    acquiring buf_pool.flush_list_mutex only once, instead of once per
+    block. This shortens the time during which log_sys.flush_order_mutex
+    is being held, and it reduces the contention with the page cleaner. */
+    if (m_made_dirty)
+      mysql_mutex_lock(&buf_pool.flush_list_mutex);
+
     m_memo.for_each_block_in_reverse(CIterate<const ReleaseBlocks>
                                      (ReleaseBlocks(lsns.first, m_commit_lsn,
-                                                    m_memo)));
+                                                    m_made_dirty, m_memo)));
     if (m_made_dirty)
+    {
+      buf_pool.page_cleaner_wakeup();
+      mysql_mutex_unlock(&buf_pool.flush_list_mutex);
       mysql_mutex_unlock(&log_sys.flush_order_mutex);
+    }
 
     m_memo.for_each_block_in_reverse(CIterate<ReleaseLatches>());
 
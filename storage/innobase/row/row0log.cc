@@ -322,6 +322,36 @@ row_log_block_free(
 	DBUG_VOID_RETURN;
 }
 
+/** Detach the records that have been buffered in the last block of
+an online log, so that they can be applied without holding index->lock
+while concurrent DML keeps appending to a fresh tail.block. Only the
+final remainder of the log (less than srv_sort_buf_size/16 bytes) will
+be applied while blocking writers.
+@param[in,out]	log	online log; the caller holds index->lock X-latch
+@return	number of bytes copied to log->head.block
+@retval	0	if the last block should be applied while holding
+index->lock */
+static
+ulint
+row_log_tail_detach(
+	row_log_t*	log)
+{
+	ut_ad(log->head.blocks == 0);
+	ut_ad(log->tail.blocks == 0);
+	ut_ad(log->head.bytes == 0);
+
+	const ulint	n = log->tail.bytes;
+
+	if (n < (srv_sort_buf_size >> 4)
+	    || !row_log_block_allocate(log->head)) {
+		return(0);
+	}
+
+	memcpy(log->head.block, log->tail.block, n);
+	log->tail.bytes = 0;
+	return(n);
+}
+
 /******************************************************//**
 Logs an operation to a secondary index that is (or was) being created. */
 void
@@ -2741,6 +2771,7 @@ row_log_table_apply_ops(
 	mem_heap_t*	offsets_heap;
 	rec_offs*	offsets;
 	bool		has_index_lock;
+	bool		detached_tail	= false;
 	dict_index_t*	index		= const_cast<dict_index_t*>(
 		dup->index);
 	dict_table_t*	new_table	= index->online_log->table;
@@ -2841,6 +2872,25 @@ row_log_table_apply_ops(
 			error = DB_SUCCESS;
 			goto func_exit;
 		}
+
+		if (!mrec) {
+			if (ulint n = row_log_tail_detach(
+				    index->online_log)) {
+				/* Let concurrent DML continue
+				buffering into tail.block while we
+				apply the copied records. */
+				has_index_lock = false;
+				detached_tail = true;
+				index->lock.x_unlock();
+
+				log_free_check();
+
+				DEBUG_SYNC_C("row_log_table_apply_detached");
+
+				next_mrec = index->online_log->head.block;
+				next_mrec_end = next_mrec + n;
+			}
+		}
 	} else {
 		os_offset_t	ofs;
 
@@ -2945,8 +2995,11 @@ row_log_table_apply_ops(
 	ut_ad((mrec == NULL) == (index->online_log->head.bytes == 0));
 
 #ifdef UNIV_DEBUG
-	if (next_mrec_end == index->online_log->head.block
-	    + srv_sort_buf_size) {
+	if (detached_tail) {
+		ut_ad(next_mrec == index->online_log->head.block);
+		ut_ad(next_mrec_end < next_mrec + srv_sort_buf_size);
+	} else if (next_mrec_end == index->online_log->head.block
+		   + srv_sort_buf_size) {
 		/* If tail.bytes == 0, next_mrec_end can also be at
 		the end of tail.block. */
 		if (index->online_log->tail.bytes == 0) {
@@ -2994,7 +3047,8 @@ row_log_table_apply_ops(
 			allow other threads to concurrently buffer
 			modifications. */
 			ut_ad(mrec >= index->online_log->head.block);
-			ut_ad(mrec_end == index->online_log->head.block
+			ut_ad(detached_tail
+			      || mrec_end == index->online_log->head.block
 			      + srv_sort_buf_size);
 			ut_ad(index->online_log->head.bytes
 			      < srv_sort_buf_size);
@@ -3044,7 +3098,16 @@ row_log_table_apply_ops(
 			has_index_lock = true;
 
 			index->online_log->head.bytes = 0;
-			index->online_log->head.blocks++;
+
+			if (detached_tail) {
+				/* The copied records were consumed.
+				Anything buffered meanwhile starts
+				from the same block position. */
+				detached_tail = false;
+			} else {
+				index->online_log->head.blocks++;
+			}
+
 			goto next_block;
 		} else if (next_mrec != NULL) {
 			ut_ad(next_mrec < next_mrec_end);
@@ -3059,6 +3122,10 @@ row_log_table_apply_ops(
 			      + index->online_log->tail.bytes);
 			ut_ad(0);
 			goto unexpected_eof;
+		} else if (detached_tail) {
+			/* tail.block only contains complete records. */
+			ut_ad(0);
+			goto unexpected_eof;
 		} else {
 			memcpy(index->online_log->head.buf, mrec,
 			       ulint(mrec_end - mrec));
@@ -3661,6 +3728,7 @@ row_log_apply_ops(
 	mem_heap_t*	heap;
 	rec_offs*	offsets;
 	bool		has_index_lock;
+	bool		detached_tail	= false;
 	const ulint	i	= 1 + REC_OFFS_HEADER_SIZE
 		+ dict_index_get_n_fields(index);
 
@@ -3741,6 +3809,25 @@ row_log_apply_ops(
 			error = DB_SUCCESS;
 			goto func_exit;
 		}
+
+		if (!mrec) {
+			if (ulint n = row_log_tail_detach(
+				    index->online_log)) {
+				/* Let concurrent DML continue
+				buffering into tail.block while we
+				apply the copied records. */
+				has_index_lock = false;
+				detached_tail = true;
+				index->lock.x_unlock();
+
+				log_free_check();
+
+				DEBUG_SYNC_C("row_log_apply_detached");
+
+				next_mrec = index->online_log->head.block;
+				next_mrec_end = next_mrec + n;
+			}
+		}
 	} else {
 		os_offset_t	ofs = static_cast<os_offset_t>(
 			index->online_log->head.blocks)
@@ -3830,8 +3917,11 @@ row_log_apply_ops(
 	ut_ad((mrec == NULL) == (index->online_log->head.bytes == 0));
 
 #ifdef UNIV_DEBUG
-	if (next_mrec_end == index->online_log->head.block
-	    + srv_sort_buf_size) {
+	if (detached_tail) {
+		ut_ad(next_mrec == index->online_log->head.block);
+		ut_ad(next_mrec_end < next_mrec + srv_sort_buf_size);
+	} else if (next_mrec_end == index->online_log->head.block
+		   + srv_sort_buf_size) {
 		/* If tail.bytes == 0, next_mrec_end can also be at
 		the end of tail.block. */
 		if (index->online_log->tail.bytes == 0) {
@@ -3871,7 +3961,8 @@ row_log_apply_ops(
 			allow other threads to concurrently buffer
 			modifications. */
 			ut_ad(mrec >= index->online_log->head.block);
-			ut_ad(mrec_end == index->online_log->head.block
+			ut_ad(detached_tail
+			      || mrec_end == index->online_log->head.block
 			      + srv_sort_buf_size);
 			ut_ad(index->online_log->head.bytes
 			      < srv_sort_buf_size);
@@ -3911,7 +4002,16 @@ row_log_apply_ops(
 			has_index_lock = true;
 
 			index->online_log->head.bytes = 0;
-			index->online_log->head.blocks++;
+
+			if (detached_tail) {
+				/* The copied records were consumed.
+				Anything buffered meanwhile starts
+				from the same block position. */
+				detached_tail = false;
+			} else {
+				index->online_log->head.blocks++;
+			}
+
 			goto next_block;
 		} else if (next_mrec != NULL) {
 			ut_ad(next_mrec < next_mrec_end);
@@ -3926,6 +4026,10 @@ row_log_apply_ops(
 			      + index->online_log->tail.bytes);
 			ut_ad(0);
 			goto unexpected_eof;
+		} else if (detached_tail) {
+			/* tail.block only contains complete records. */
+			ut_ad(0);
+			goto unexpected_eof;
 		} else {
 			memcpy(index->online_log->head.buf, mrec,
 			       ulint(mrec_end - mrec));
@@ -172,6 +172,9 @@ ulong		srv_page_size;
 ulong		srv_page_size_shift;
 /** innodb_log_write_ahead_size */
 ulong		srv_log_write_ahead_size;
+/** innodb_log_write_pipelined; whether log_write_up_to() may write
+the next group while the previous one is being flushed */
+my_bool		srv_log_write_pipelined;
 
 /** innodb_adaptive_flushing; try to flush dirty pages so as to avoid
 IO bursts at the checkpoints. */
@@ -2506,6 +2506,31 @@ int ha_maria::rnd_end()
 }
 
 
+/*
+  Start a sampled scan
+
+  For BLOCK_RECORD tables whole head pages are skipped at random, so
+  only about 'fraction' of the data file is read. Every row of a page
+  that is read is part of the sample.
+*/
+
+int ha_maria::sample_init(double fraction)
+{
+  int error;
+  THD *thd= ha_thd();
+  if (file->s->data_file_type != BLOCK_RECORD || fraction >= 1.0)
+    return handler::sample_init(fraction);
+  if ((error= ha_rnd_init(TRUE)))
+    return error;
+  sample_fraction= 1.0;
+  file->scan.sample_fraction= fraction;
+  my_rnd_init(&file->scan.sample_rnd,
+              (ulong) (thd_rnd(thd) * 0x3FFFFFFFL),
+              (ulong) (thd_rnd(thd) * 0x3FFFFFFFL));
+  return 0;
+}
+
+
 int ha_maria::rnd_next(uchar *buf)
 {
   register_handler(file);
@@ -5277,6 +5277,7 @@ my_bool _ma_scan_init_block_record(MARIA_HA *info)
   info->scan.bitmap_pos= info->scan.bitmap_end;
   info->scan.bitmap_page= (pgcache_page_no_t) 0 - share->bitmap.pages_covered;
   info->scan.max_page= share->state.state.data_file_length / share->block_size;
+  info->scan.sample_fraction= 1.0;
   /*
     We need to flush what's in memory (bitmap.map) to page cache otherwise, as
     we are going to read bitmaps from page cache in table scan (see
@@ -5521,6 +5522,10 @@ int _ma_scan_block_record(MARIA_HA *info, uchar *record,
             DBUG_PRINT("info", ("Found end of file"));
             DBUG_RETURN((my_errno= HA_ERR_END_OF_FILE));
           }
+          /* Sampled scan: skip the head page without reading it */
+          if (info->scan.sample_fraction < 1.0 &&
+              my_rnd(&info->scan.sample_rnd) > info->scan.sample_fraction)
+            continue;
           if (!(pagecache_read(share->pagecache,
                                &info->dfile,
                                page, 0, info->scan.page_buff,
@@ -30,6 +30,7 @@
 #include <myisampack.h>				/* packing of keys */
 #include <my_tree.h>
 #include <my_bitmap.h>
+#include <my_rnd.h>
 #include <my_pthread.h>
 #include <thr_lock.h>
 #include <hash.h>
@@ -900,6 +901,9 @@ typedef struct st_maria_block_scan
   uint number_of_rows, bit_pos;
   MARIA_RECORD_POS row_base_page;
   ulonglong row_changes;
+  /* Fraction of head pages read by a sampled scan; 1.0 reads all */
+  double sample_fraction;
+  struct my_rnd_struct sample_rnd;
 } MARIA_BLOCK_SCAN;
 
 